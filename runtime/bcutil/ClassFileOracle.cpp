@@ -1254,13 +1254,13 @@ ClassFileOracle::throwGenericErrorWithCustomMsg(UDATA code, UDATA offset)
 	if (NULL != errorMsg) {
 		_buildResult = GenericErrorCustomMsg;
 		buildError((J9CfrError*)errorMsg, code, GenericErrorCustomMsg, offset);
-		J9TranslationBufferSet* dlb = _context->javaVM()->dynamicLoadBuffers;
+		U_8 *classFileError = _context->classFileError();
 		/* avoid leaking memory if classFileError was not previously null. Do not free
 		 * memory if _classFileBuffer from ROMClassBuilder is using the same address. */
-		if ((NULL != dlb->classFileError) && (_romBuilderClassFileBuffer != dlb->classFileError)) {
-			j9mem_free_memory(dlb->classFileError);
+		if ((NULL != classFileError) && (_romBuilderClassFileBuffer != classFileError)) {
+			j9mem_free_memory(classFileError);
 		}
-		dlb->classFileError = errorMsg;
+		_context->recordCFRError(errorMsg);
 	}
 }
 
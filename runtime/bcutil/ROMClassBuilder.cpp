@@ -169,6 +169,59 @@ j9bcutil_buildRomClassIntoBuffer(
 	return result;
 }
 
+extern "C" IDATA
+j9bcutil_buildRomClassIntoScratch(
+		J9JavaVM * javaVM,
+		J9ClassLoader * classLoader,
+		U_8 * className,
+		UDATA classNameLength,
+		U_8 * classFileBytes,
+		UDATA classFileSize,
+		UDATA bctFlags,
+		UDATA bcuFlags,
+		J9ROMClass ** romClassPtr
+)
+{
+	/* Neither the VM-wide ROMClassBuilder nor the string intern table is used, so no lock is needed */
+	PORT_ACCESS_FROM_JAVAVM(javaVM);
+	J9BytecodeVerificationData *verifyBuffers = javaVM->bytecodeVerificationData;
+	J9PortAllocationStrategy portAllocationStrategy(PORTLIB);
+	ROMClassBuilder romClassBuilder(NULL, PORTLIB, 0, NULL == verifyBuffers ? NULL : verifyBuffers->excludeAttribute, NULL == verifyBuffers ? NULL : j9bcv_verifyClassStructure);
+	ROMClassCreationContext context(PORTLIB, javaVM, classLoader, classFileBytes, classFileSize, bctFlags, bcuFlags, &portAllocationStrategy, className, classNameLength);
+	IDATA result = IDATA(romClassBuilder.buildROMClass(&context));
+	J9ROMClass *romClass = context.romClass();
+	U_8 *classFileBuffer = romClassBuilder.releaseClassFileBuffer();
+	U_8 *classFileError = context.privateClassFileError();
+
+	/* The error is not reported here, the class loader rebuilds the class when it defines it */
+	if (classFileError != classFileBuffer) {
+		j9mem_free_memory(classFileError);
+	}
+	j9mem_free_memory(classFileBuffer);
+
+	if ((BCT_ERR_NO_ERROR != result) && (NULL != romClass)) {
+		j9mem_free_memory(romClass);
+		romClass = NULL;
+	}
+	*romClassPtr = romClass;
+	return result;
+}
+
+extern "C" J9ROMClass *
+j9bcutil_copyRomClassIntoClassLoader(J9JavaVM *javaVM, J9ClassLoader *classLoader, J9ROMClass *romClass)
+{
+	ROMClassSegmentAllocationStrategy romClassSegmentAllocationStrategy(javaVM, classLoader);
+	UDATA romSize = romClass->romSize;
+	U_8 *romClassBuffer = romClassSegmentAllocationStrategy.allocate(romSize);
+
+	if (NULL != romClassBuffer) {
+		/* A ROMClass built by j9bcutil_buildRomClassIntoScratch() only refers to itself through SRPs */
+		memcpy(romClassBuffer, romClass, romSize);
+		romClassSegmentAllocationStrategy.updateFinalROMSize(romSize);
+	}
+	return (J9ROMClass *)romClassBuffer;
+}
+
 extern "C" IDATA
 j9bcutil_buildRomClass(J9LoadROMClassData *loadData, U_8 * intermediateData, UDATA intermediateDataLength, J9JavaVM *javaVM, UDATA bctFlags, UDATA classFileBytesReplaced, UDATA isIntermediateROMClass, J9TranslationLocalBuffer *localBuffer)
 {
@@ -74,7 +74,9 @@ public:
 		_existingRomMethod(NULL),
 		_reusingIntermediateClassData(false),
 		_creatingIntermediateROMClass(false),
-		_patchMap(NULL)
+		_patchMap(NULL),
+		_privateBuild(false),
+		_privateClassFileError(NULL)
 	{
 	}
 
@@ -113,7 +115,9 @@ public:
 		_existingRomMethod(NULL),
 		_reusingIntermediateClassData(false),
 		_creatingIntermediateROMClass(false),
-		_patchMap(NULL)
+		_patchMap(NULL),
+		_privateBuild(false),
+		_privateClassFileError(NULL)
 	{
 	}
 
@@ -159,7 +163,9 @@ public:
 		_existingRomMethod(NULL),
 		_reusingIntermediateClassData(false),
 		_creatingIntermediateROMClass(creatingIntermediateROMClass),
-		_patchMap(NULL)
+		_patchMap(NULL),
+		_privateBuild(false),
+		_privateClassFileError(NULL)
 	{
 		if ((NULL != _javaVM) && (NULL != _javaVM->dynamicLoadBuffers)) {
 			/* localBuffer should not be NULL */
@@ -178,6 +184,60 @@ public:
 		}
 	}
 
+	/*
+	 * Context for building a ROMClass for classLoader into memory private to the caller, ahead of the
+	 * class loader defining the class. The class is checked and translated as it is when the class
+	 * loader defines it, but the VM-wide translation state (dynamicLoadBuffers and the string intern
+	 * tables) is not used, so the classTableMutex need not be held. A class file error is kept in the
+	 * context, see privateClassFileError(), and -verbose:romclass statistics are left to the define.
+	 */
+	ROMClassCreationContext(
+			J9PortLibrary *portLibrary, J9JavaVM *javaVM, J9ClassLoader *classLoader, U_8 *classFileBytes, UDATA classFileSize, UDATA bctFlags, UDATA bcuFlags,
+			AllocationStrategy *allocationStrategy, U_8 *className, UDATA classNameLength) :
+		_portLibrary(portLibrary),
+		_javaVM(javaVM),
+		_classFileBytes(classFileBytes),
+		_classFileSize(classFileSize),
+		_bctFlags(bctFlags),
+		_bcuFlags(bcuFlags),
+		_findClassFlags(0),
+		_allocationStrategy(allocationStrategy),
+		_romClass(NULL),
+		_clazz(NULL),
+		_className(className),
+		_classNameLength(classNameLength),
+		_hostPackageName(NULL),
+		_hostPackageLength(0),
+		_intermediateClassData(NULL),
+		_intermediateClassDataLength(0),
+		_classLoader(classLoader),
+		_cpIndex(0),
+		_loadLocation(0),
+		_dynamicLoadStats(NULL),
+		_sharedStringInternTable(NULL),
+		_classFileBytesReplaced(false),
+#if defined(J9VM_OPT_JVMTI)
+		_retransformAllowed(0 != (javaVM->requiredDebugAttributes & J9VM_DEBUG_ATTRIBUTE_ALLOW_RETRANSFORM)),
+#else
+		_retransformAllowed(false),
+#endif
+		_interningEnabled(false),
+		_verboseROMClass(false),
+		_verboseLastBufferSizeExceeded(0),
+		_verboseOutOfMemoryCount(0),
+		_verboseCurrentPhase(ROMClassCreation),
+		_buildResult(OK),
+		_forceDebugDataInLine(false),
+		_doDebugCompare(false),
+		_existingRomMethod(NULL),
+		_reusingIntermediateClassData(false),
+		_creatingIntermediateROMClass(false),
+		_patchMap(NULL),
+		_privateBuild(true),
+		_privateClassFileError(NULL)
+	{
+	}
+
 	bool isCreatingIntermediateROMClass() const { return _creatingIntermediateROMClass; }
 	U_8 *classFileBytes() const { return _classFileBytes; }
 	UDATA classFileSize() const { return _classFileSize; }
@@ -198,6 +258,18 @@ public:
 	bool isVerbose() const { return _verboseROMClass; }
 	J9ClassLoader *classLoader() const { return _classLoader; }
 	J9JavaVM *javaVM() const { return _javaVM; }
+	/* The error recorded by the last recordCFRError(), or NULL if there is none */
+	U_8 *classFileError() const
+	{
+		if (_privateBuild) {
+			return _privateClassFileError;
+		} else if ((NULL != _javaVM) && (NULL != _javaVM->dynamicLoadBuffers)) {
+			return _javaVM->dynamicLoadBuffers->classFileError;
+		}
+		return NULL;
+	}
+	/* The error recorded by a private build. The caller owns it unless it is the ROMClassBuilder's class file buffer. */
+	U_8 *privateClassFileError() const { return _privateClassFileError; }
 	J9VMThread *currentVMThread() const { return _javaVM->internalVMFunctions->currentVMThread(_javaVM); }
 	J9PortLibrary *portLibrary() const { return _portLibrary; }
 	UDATA cpIndex() const { return _cpIndex; }
@@ -565,7 +637,9 @@ public:
 
 	void recordCFRError(U_8 *cfrError)
 	{
-		if ((NULL != _javaVM) && (NULL != _javaVM->dynamicLoadBuffers)) {
+		if (_privateBuild) {
+			_privateClassFileError = cfrError;
+		} else if ((NULL != _javaVM) && (NULL != _javaVM->dynamicLoadBuffers)) {
 			_javaVM->dynamicLoadBuffers->classFileError = cfrError;
 		}
 	}
@@ -577,7 +651,11 @@ public:
 		 * into _javaVM->dynamicLoadBuffers->classFileError, if the internal buffer that is free'd matches the one in
 		 * _javaVM->dynamicLoadBuffers->classFileError, then it must be set to NULL to avoid a double free in
 		 * j9bcutil_freeTranslationBuffers()*/
-		if ((NULL != _javaVM) && (NULL != _javaVM->dynamicLoadBuffers) && (buffer == _javaVM->dynamicLoadBuffers->classFileError)) {
+		if (_privateBuild) {
+			if (buffer == _privateClassFileError) {
+				_privateClassFileError = NULL;
+			}
+		} else if ((NULL != _javaVM) && (NULL != _javaVM->dynamicLoadBuffers) && (buffer == _javaVM->dynamicLoadBuffers->classFileError)) {
 			_javaVM->dynamicLoadBuffers->classFileError = NULL;
 		}
 		j9mem_free_memory(buffer);
@@ -826,6 +904,8 @@ private:
 	bool _reusingIntermediateClassData;
 	bool _creatingIntermediateROMClass;
 	J9ClassPatchMap *_patchMap;
+	bool _privateBuild;
+	U_8 *_privateClassFileError;
 
 	J9ROMMethod * romMethodFromOffset(IDATA offset);
 };
@@ -169,17 +169,28 @@ bcutil_J9VMDllMain(J9JavaVM* vm, IDATA stage, void* reserved)
 				returnVal = J9VMDLLMAIN_FAILED;
 			}
 			vm->mapMemoryBuffer = vm->mapMemoryResultsBuffer + MAP_MEMORY_RESULTS_BUFFER_SIZE;
+
+			if ((J9VMDLLMAIN_OK == returnVal) && (0 != initializeROMClassPrebuild(vm))) {
+				vm->internalVMFunctions->setErrorJ9dll(PORTLIB, loadInfo, "failed to initialize ROMClass prebuild", FALSE);
+				returnVal = J9VMDLLMAIN_FAILED;
+			}
 			break;
 
 		case AGENTS_STARTED :
 			break;
 
 		case JCL_INITIALIZED :
+			startROMClassPrebuild(vm);
+			break;
+
+		case INTERPRETER_SHUTDOWN :
+			shutdownROMClassPrebuild(vm);
 			break;
 
 		case LIBRARIES_ONUNLOAD :
 			loadInfo = FIND_DLL_TABLE_ENTRY( THIS_DLL_NAME );
 			if (IS_STAGE_COMPLETED(loadInfo->completedBits, BUFFERS_ALLOC_STAGE) && vm->dynamicLoadBuffers) {
+				shutdownROMClassPrebuild(vm);
 				shutdownROMClassBuilder(vm);
 				j9bcutil_freeAllTranslationBuffers(vm->portLibrary, vm->dynamicLoadBuffers);
 				vm->dynamicLoadBuffers = 0;
@@ -106,6 +106,111 @@ romVerboseRecordPhaseStart(void *verboseContext, UDATA phase);
 void
 romVerboseRecordPhaseEnd(void *verboseContext, UDATA phase);
 
+/* ---------------- defineclass.c ---------------- */
+
+/**
+ * @brief Compute the translation flags for building the ROMClass of a class being loaded.
+ * @param[in] vmThread the current J9VMThread
+ * @param[in] loadData the class being loaded
+ * @return the BCT_* translation flags
+ */
+UDATA
+getROMClassTranslationFlags(J9VMThread *vmThread, J9LoadROMClassData *loadData);
+
+/* ---------------- classprebuild.c ---------------- */
+
+#define J9_ROMCLASS_PREBUILD_STATE_UNINITIALIZED 0
+#define J9_ROMCLASS_PREBUILD_STATE_RUNNING 1
+#define J9_ROMCLASS_PREBUILD_STATE_STOP 2
+
+#define J9_ROMCLASS_PREBUILD_MAX_THREADS 8
+/* Upper bound on the class file and ROMClass bytes retained for prebuilt ROMClasses which have not been defined yet */
+#define J9_ROMCLASS_PREBUILD_MAX_PENDING_BYTES (64 * 1024 * 1024)
+
+typedef struct J9ROMClassPrebuildName {
+	U_8 *name;
+	UDATA length;
+} J9ROMClassPrebuildName;
+
+typedef struct J9ROMClassPrebuildEntry {
+	U_8 *className;
+	UDATA classNameLength;
+	J9ClassLoader *classLoader;
+	/* scratch copy, allocated with j9mem_allocate_memory(); copied into the class loader's segments when used */
+	J9ROMClass *romClass;
+	U_8 *classData;
+	UDATA classDataLength;
+} J9ROMClassPrebuildEntry;
+
+typedef struct J9ROMClassPrebuildState {
+	J9JavaVM *javaVM;
+	omrthread_monitor_t mutex;
+	UDATA state;
+	char *classListFileName;
+	UDATA threadCount;
+	UDATA activeThreads;
+	/* names of the classes to prebuild, in the order they are handed to the workers */
+	U_8 *classListBuffer;
+	J9ROMClassPrebuildName *classNames;
+	UDATA classCount;
+	UDATA nextClassIndex;
+	/* application class path entries, searched in order */
+	char *classPathBuffer;
+	char **classPathEntries;
+	BOOLEAN *classPathEntryIsDirectory;
+	UDATA classPathEntryCount;
+	UDATA maxPathLength;
+	/* prebuilt ROMClasses waiting for their defineClass; all access must be done while holding classTableMutex */
+	J9HashTable *prebuiltTable;
+	/* class file and ROMClass bytes retained by prebuiltTable; protected by mutex */
+	UDATA pendingBytes;
+	UDATA builtCount;
+	UDATA usedCount;
+	UDATA discardedCount;
+} J9ROMClassPrebuildState;
+
+/**
+ * @brief Consume the -XX:ROMClassPrebuildList= and -XX:ROMClassPrebuildThreads= options.
+ * @param[in] vm the J9JavaVM
+ * @return 0 on success (including when prebuilding was not requested), -1 on failure
+ */
+IDATA
+initializeROMClassPrebuild(J9JavaVM *vm);
+
+/**
+ * @brief Read the class list and application class path and start the prebuild worker threads.
+ * Prebuilding is skipped when shared classes are enabled, since the ROMClasses then come from the cache.
+ * @param[in] vm the J9JavaVM
+ */
+void
+startROMClassPrebuild(J9JavaVM *vm);
+
+/**
+ * @brief Stop the prebuild worker threads and release any ROMClasses which were never defined.
+ * @param[in] vm the J9JavaVM
+ */
+void
+shutdownROMClassPrebuild(J9JavaVM *vm);
+
+/**
+ * @brief Look up and remove a prebuilt ROMClass for a class being defined.
+ * The prebuilt ROMClass is returned only if it was built by the same class loader
+ * from exactly the same class file bytes. The ROMClass is then copied into the class loader's
+ * ROM segments; a prebuilt ROMClass which is not used is freed.
+ *
+ * Warning: sender must hold class table mutex before calling.
+ *
+ * @param[in] vmThread the current J9VMThread
+ * @param[in] classLoader the defining class loader
+ * @param[in] className the class name
+ * @param[in] classNameLength length of className
+ * @param[in] classData the class file bytes being defined
+ * @param[in] classDataLength length of classData
+ * @return the prebuilt ROMClass, or NULL if there is none
+ */
+J9ROMClass *
+findPrebuiltROMClass(J9VMThread *vmThread, J9ClassLoader *classLoader, U_8 *className, UDATA classNameLength, U_8 *classData, UDATA classDataLength);
+
 #ifdef __cplusplus
 }
 #endif
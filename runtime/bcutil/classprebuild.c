@@ -0,0 +1,704 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+/*
+ * Speculative ROMClass creation for the application class loader.
+ *
+ * Given a list of classes (typically the class load order of a previous run), a small pool of
+ * worker threads reads the class files from the application class path and builds their ROMClasses
+ * ahead of the application. When the class loader later defines a class from the same bytes,
+ * internalDefineClass() picks up the prebuilt ROMClass instead of parsing and translating the
+ * class file on the requesting thread.
+ *
+ * The workers read, parse and translate the class files concurrently, without holding the
+ * classTableMutex. Each ROMClass is built into scratch memory with a private ROMClassBuilder, and
+ * the classTableMutex is only taken to publish it. The build uses the application class loader and
+ * the requested class name, so the class is checked and translated as it is when it is defined. The class loader's ROM segments are only used
+ * when the class is defined from the same bytes; until then the scratch copy is freed whenever the
+ * build is discarded.
+ */
+
+#include <string.h>
+
+#include "j9.h"
+#include "j9port.h"
+#include "j9protos.h"
+#include "j9consts.h"
+#include "jvminit.h"
+#include "ut_j9bcu.h"
+#include "bcutil_api.h"
+#include "bcutil_internal.h"
+#ifdef J9VM_OPT_ZIP_SUPPORT
+#include "vmi.h"
+#endif /* J9VM_OPT_ZIP_SUPPORT */
+
+#if defined(J9VM_OPT_DYNAMIC_LOAD_SUPPORT) /* File Level Build Flags */
+
+#define ZIP_STATE_UNOPENED 0
+#define ZIP_STATE_OPEN 1
+#define ZIP_STATE_FAILED 2
+
+typedef struct J9ROMClassPrebuildWorker {
+	J9ROMClassPrebuildState *state;
+	char *pathBuffer;
+#ifdef J9VM_OPT_ZIP_SUPPORT
+	VMIZipFile *zipFiles;
+	U_8 *zipStates;
+#endif /* J9VM_OPT_ZIP_SUPPORT */
+} J9ROMClassPrebuildWorker;
+
+static U_8 *readWholeFile(J9PortLibrary *portLib, const char *fileName, UDATA *length);
+static BOOLEAN parseClassList(J9ROMClassPrebuildState *state);
+static BOOLEAN parseClassPath(J9ROMClassPrebuildState *state);
+static UDATA prebuildEntryHashFn(void *key, void *userData);
+static UDATA prebuildEntryEqualFn(void *leftKey, void *rightKey, void *userData);
+static BOOLEAN isClassLoadHooked(J9JavaVM *vm);
+static U_8 *readClassBytes(J9ROMClassPrebuildWorker *worker, J9ROMClassPrebuildName *className, UDATA *length);
+static void prebuildROMClass(J9VMThread *currentThread, J9ROMClassPrebuildState *state, J9ROMClassPrebuildName *className, U_8 *classData, UDATA classDataLength);
+static int J9THREAD_PROC prebuildWorkerThreadProc(void *entryArg);
+
+/**
+ * Read a file into a newly allocated, NUL terminated buffer.
+ *
+ * @param[in] portLib the port library
+ * @param[in] fileName the file to read
+ * @param[out] length the number of bytes read, excluding the terminator
+ * @return the buffer, or NULL if the file could not be read
+ */
+static U_8 *
+readWholeFile(J9PortLibrary *portLib, const char *fileName, UDATA *length)
+{
+	PORT_ACCESS_FROM_PORT(portLib);
+	U_8 *buffer = NULL;
+	I_64 fileSize = 0;
+	IDATA fd = j9file_open(fileName, EsOpenRead, 0);
+
+	if (-1 == fd) {
+		return NULL;
+	}
+
+	fileSize = j9file_seek(fd, 0, EsSeekEnd);
+	/* Restrict file size to < 2G */
+	if ((-1 != fileSize) && (fileSize <= J9CONST64(0x7FFFFFFF))) {
+		buffer = j9mem_allocate_memory((UDATA)fileSize + 1, J9MEM_CATEGORY_CLASSES);
+		if (NULL != buffer) {
+			j9file_seek(fd, 0, EsSeekSet);
+			if (j9file_read(fd, buffer, (IDATA)fileSize) == (IDATA)fileSize) {
+				buffer[fileSize] = '\0';
+				*length = (UDATA)fileSize;
+			} else {
+				j9mem_free_memory(buffer);
+				buffer = NULL;
+			}
+		}
+	}
+	j9file_close(fd);
+
+	return buffer;
+}
+
+/**
+ * Split the class list file into class names. Each non-empty line which does not start with '#'
+ * names one class, either in binary ("a.b.C") or internal ("a/b/C") form, optionally followed by ".class".
+ *
+ * @param[in] state the prebuild state
+ * @return TRUE on success, FALSE on failure
+ */
+static BOOLEAN
+parseClassList(J9ROMClassPrebuildState *state)
+{
+	PORT_ACCESS_FROM_JAVAVM(state->javaVM);
+	UDATA length = 0;
+	UDATA lineCount = 1;
+	U_8 *cursor = NULL;
+	U_8 *end = NULL;
+
+	state->classListBuffer = readWholeFile(PORTLIB, state->classListFileName, &length);
+	if (NULL == state->classListBuffer) {
+		return FALSE;
+	}
+
+	end = state->classListBuffer + length;
+	for (cursor = state->classListBuffer; cursor < end; cursor++) {
+		if ('\n' == *cursor) {
+			lineCount += 1;
+		}
+	}
+	state->classNames = j9mem_allocate_memory(lineCount * sizeof(J9ROMClassPrebuildName), J9MEM_CATEGORY_CLASSES);
+	if (NULL == state->classNames) {
+		return FALSE;
+	}
+
+	cursor = state->classListBuffer;
+	while (cursor < end) {
+		U_8 *name = cursor;
+		UDATA nameLength = 0;
+		UDATA i = 0;
+
+		while ((cursor < end) && ('\n' != *cursor) && ('\r' != *cursor)) {
+			cursor += 1;
+		}
+		nameLength = cursor - name;
+		while ((cursor < end) && (('\n' == *cursor) || ('\r' == *cursor))) {
+			cursor += 1;
+		}
+
+		while ((nameLength > 0) && ((' ' == name[0]) || ('\t' == name[0]))) {
+			name += 1;
+			nameLength -= 1;
+		}
+		while ((nameLength > 0) && ((' ' == name[nameLength - 1]) || ('\t' == name[nameLength - 1]))) {
+			nameLength -= 1;
+		}
+		if ((nameLength > (UDATA)LITERAL_STRLEN(".class"))
+			&& (0 == memcmp(name + nameLength - LITERAL_STRLEN(".class"), ".class", LITERAL_STRLEN(".class")))
+		) {
+			nameLength -= (UDATA)LITERAL_STRLEN(".class");
+		}
+		if ((0 == nameLength) || ('#' == name[0])) {
+			continue;
+		}
+		for (i = 0; i < nameLength; i++) {
+			if ('.' == name[i]) {
+				name[i] = '/';
+			}
+		}
+		state->classNames[state->classCount].name = name;
+		state->classNames[state->classCount].length = nameLength;
+		state->classCount += 1;
+		if (nameLength > state->maxPathLength) {
+			state->maxPathLength = nameLength;
+		}
+	}
+
+	return TRUE;
+}
+
+/**
+ * Split the java.class.path system property into its entries, recording which entries are directories.
+ *
+ * @param[in] state the prebuild state
+ * @return TRUE on success, FALSE on failure
+ */
+static BOOLEAN
+parseClassPath(J9ROMClassPrebuildState *state)
+{
+	J9JavaVM *vm = state->javaVM;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	J9VMSystemProperty *property = NULL;
+	char separator = (char)j9sysinfo_get_classpathSeparator();
+	UDATA entryCount = 1;
+	UDATA maxEntryLength = 0;
+	char *cursor = NULL;
+
+	if ((J9SYSPROP_ERROR_NONE != vm->internalVMFunctions->getSystemProperty(vm, "java.class.path", &property))
+		|| (NULL == property->value)
+	) {
+		return FALSE;
+	}
+
+	state->classPathBuffer = j9mem_allocate_memory(strlen(property->value) + 1, J9MEM_CATEGORY_CLASSES);
+	if (NULL == state->classPathBuffer) {
+		return FALSE;
+	}
+	strcpy(state->classPathBuffer, property->value);
+
+	for (cursor = state->classPathBuffer; '\0' != *cursor; cursor++) {
+		if (separator == *cursor) {
+			entryCount += 1;
+		}
+	}
+	state->classPathEntries = j9mem_allocate_memory(entryCount * (sizeof(char *) + sizeof(BOOLEAN)), J9MEM_CATEGORY_CLASSES);
+	if (NULL == state->classPathEntries) {
+		return FALSE;
+	}
+	state->classPathEntryIsDirectory = (BOOLEAN *)(state->classPathEntries + entryCount);
+
+	cursor = state->classPathBuffer;
+	while ('\0' != *cursor) {
+		char *entry = cursor;
+		UDATA entryLength = 0;
+
+		while (('\0' != *cursor) && (separator != *cursor)) {
+			cursor += 1;
+		}
+		entryLength = cursor - entry;
+		if ('\0' != *cursor) {
+			*cursor = '\0';
+			cursor += 1;
+		}
+		if (0 != entryLength) {
+			state->classPathEntries[state->classPathEntryCount] = entry;
+			state->classPathEntryIsDirectory[state->classPathEntryCount] = (EsIsDir == j9file_attr(entry));
+			state->classPathEntryCount += 1;
+			if (entryLength > maxEntryLength) {
+				maxEntryLength = entryLength;
+			}
+		}
+	}
+
+	/* room for "<entry>/<class name>.class" */
+	state->maxPathLength += maxEntryLength + (UDATA)LITERAL_STRLEN("/.class") + 1;
+
+	return 0 != state->classPathEntryCount;
+}
+
+static UDATA
+prebuildEntryHashFn(void *key, void *userData)
+{
+	J9ROMClassPrebuildEntry *entry = (J9ROMClassPrebuildEntry *)key;
+	UDATA hash = 0;
+	UDATA i = 0;
+
+	for (i = 0; i < entry->classNameLength; ++i) {
+		hash = (hash << 5) - hash + entry->className[i];
+	}
+
+	return hash;
+}
+
+static UDATA
+prebuildEntryEqualFn(void *leftKey, void *rightKey, void *userData)
+{
+	J9ROMClassPrebuildEntry *left = (J9ROMClassPrebuildEntry *)leftKey;
+	J9ROMClassPrebuildEntry *right = (J9ROMClassPrebuildEntry *)rightKey;
+
+	return J9UTF8_DATA_EQUALS(left->className, left->classNameLength, right->className, right->classNameLength);
+}
+
+/**
+ * A prebuilt ROMClass must not be used if an agent may replace the class file bytes on load.
+ */
+static BOOLEAN
+isClassLoadHooked(J9JavaVM *vm)
+{
+	return J9_EVENT_IS_HOOKED(vm->hookInterface, J9HOOK_VM_CLASS_LOAD_HOOK)
+		|| J9_EVENT_IS_HOOKED(vm->hookInterface, J9HOOK_VM_CLASS_LOAD_HOOK2);
+}
+
+IDATA
+initializeROMClassPrebuild(J9JavaVM *vm)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	J9ROMClassPrebuildState *state = NULL;
+	char *classListFileName = NULL;
+	UDATA threadCount = 0;
+	IDATA argIndex = FIND_AND_CONSUME_VMARG(STARTSWITH_MATCH, VMOPT_XXROMCLASSPREBUILDLIST_EQUALS, NULL);
+
+	if (argIndex >= 0) {
+		GET_OPTION_VALUE(argIndex, '=', &classListFileName);
+	}
+
+	argIndex = FIND_AND_CONSUME_VMARG(STARTSWITH_MATCH, VMOPT_XXROMCLASSPREBUILDTHREADS_EQUALS, NULL);
+	if (argIndex >= 0) {
+		char *optname = VMOPT_XXROMCLASSPREBUILDTHREADS_EQUALS;
+		if (OPTION_OK != GET_INTEGER_VALUE(argIndex, optname, threadCount)) {
+			return -1;
+		}
+	} else {
+		UDATA cpuCount = j9sysinfo_get_number_CPUs_by_type(J9PORT_CPU_TARGET);
+		/* leave a CPU for the main thread */
+		threadCount = (cpuCount > 1) ? (cpuCount - 1) : 1;
+	}
+	if (threadCount > J9_ROMCLASS_PREBUILD_MAX_THREADS) {
+		threadCount = J9_ROMCLASS_PREBUILD_MAX_THREADS;
+	}
+
+	if ((NULL == classListFileName) || ('\0' == *classListFileName) || (0 == threadCount)) {
+		return 0;
+	}
+
+	state = j9mem_allocate_memory(sizeof(J9ROMClassPrebuildState), J9MEM_CATEGORY_CLASSES);
+	if (NULL == state) {
+		return -1;
+	}
+	memset(state, 0, sizeof(J9ROMClassPrebuildState));
+	state->javaVM = vm;
+	state->state = J9_ROMCLASS_PREBUILD_STATE_UNINITIALIZED;
+	state->classListFileName = classListFileName;
+	state->threadCount = threadCount;
+	if (0 != omrthread_monitor_init_with_name(&state->mutex, 0, "ROMClass prebuild mutex")) {
+		j9mem_free_memory(state);
+		return -1;
+	}
+	vm->dynamicLoadBuffers->romClassPrebuilder = state;
+
+	return 0;
+}
+
+void
+startROMClassPrebuild(J9JavaVM *vm)
+{
+	J9ROMClassPrebuildState *state = (J9ROMClassPrebuildState *)vm->dynamicLoadBuffers->romClassPrebuilder;
+	UDATA i = 0;
+
+	if (NULL == state) {
+		return;
+	}
+
+	if ((NULL != vm->sharedClassConfig)
+		|| !parseClassList(state)
+		|| (0 == state->classCount)
+		|| !parseClassPath(state)
+	) {
+		Trc_BCU_startROMClassPrebuild_Skipped(state->classListFileName, state->classCount, state->classPathEntryCount);
+		shutdownROMClassPrebuild(vm);
+		return;
+	}
+
+	state->prebuiltTable = hashTableNew(OMRPORT_FROM_J9PORT(vm->portLibrary), J9_GET_CALLSITE(), (U_32)state->classCount,
+		sizeof(J9ROMClassPrebuildEntry), sizeof(char *), 0,
+		J9MEM_CATEGORY_CLASSES, prebuildEntryHashFn, prebuildEntryEqualFn, NULL, vm);
+	if (NULL == state->prebuiltTable) {
+		shutdownROMClassPrebuild(vm);
+		return;
+	}
+
+	Trc_BCU_startROMClassPrebuild(state->classListFileName, state->classCount, state->classPathEntryCount, state->threadCount);
+
+	omrthread_monitor_enter(state->mutex);
+	state->state = J9_ROMCLASS_PREBUILD_STATE_RUNNING;
+	for (i = 0; i < state->threadCount; i++) {
+		if (J9THREAD_SUCCESS != vm->internalVMFunctions->createThreadWithCategory(NULL, vm->defaultOSStackSize, J9THREAD_PRIORITY_NORMAL,
+				0, prebuildWorkerThreadProc, state, J9THREAD_CATEGORY_SYSTEM_THREAD)
+		) {
+			break;
+		}
+		state->activeThreads += 1;
+	}
+	omrthread_monitor_exit(state->mutex);
+}
+
+void
+shutdownROMClassPrebuild(J9JavaVM *vm)
+{
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	J9ROMClassPrebuildState *state = NULL;
+
+	if (NULL == vm->dynamicLoadBuffers) {
+		return;
+	}
+	state = (J9ROMClassPrebuildState *)vm->dynamicLoadBuffers->romClassPrebuilder;
+	if (NULL == state) {
+		return;
+	}
+
+	omrthread_monitor_enter(state->mutex);
+	state->state = J9_ROMCLASS_PREBUILD_STATE_STOP;
+	omrthread_monitor_notify_all(state->mutex);
+	while (0 != state->activeThreads) {
+		omrthread_monitor_wait(state->mutex);
+	}
+	omrthread_monitor_exit(state->mutex);
+
+	omrthread_monitor_enter(vm->classTableMutex);
+	vm->dynamicLoadBuffers->romClassPrebuilder = NULL;
+	omrthread_monitor_exit(vm->classTableMutex);
+
+	Trc_BCU_shutdownROMClassPrebuild(state->builtCount, state->usedCount, state->discardedCount);
+
+	if (NULL != state->prebuiltTable) {
+		J9HashTableState walkState;
+		J9ROMClassPrebuildEntry *entry = hashTableStartDo(state->prebuiltTable, &walkState);
+		while (NULL != entry) {
+			j9mem_free_memory(entry->romClass);
+			j9mem_free_memory(entry->classData);
+			entry = hashTableNextDo(&walkState);
+		}
+		hashTableFree(state->prebuiltTable);
+	}
+	j9mem_free_memory(state->classPathEntries);
+	j9mem_free_memory(state->classPathBuffer);
+	j9mem_free_memory(state->classNames);
+	j9mem_free_memory(state->classListBuffer);
+	omrthread_monitor_destroy(state->mutex);
+	j9mem_free_memory(state);
+}
+
+J9ROMClass *
+findPrebuiltROMClass(J9VMThread *vmThread, J9ClassLoader *classLoader, U_8 *className, UDATA classNameLength, U_8 *classData, UDATA classDataLength)
+{
+	J9JavaVM *vm = vmThread->javaVM;
+	J9ROMClassPrebuildState *state = (J9ROMClassPrebuildState *)vm->dynamicLoadBuffers->romClassPrebuilder;
+	J9ROMClassPrebuildEntry query = {0};
+	J9ROMClassPrebuildEntry *entry = NULL;
+	J9ROMClass *romClass = NULL;
+	U_8 *entryClassData = NULL;
+	UDATA entryClassDataLength = 0;
+	J9ROMClass *entryROMClass = NULL;
+	UDATA entryBytes = 0;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	if ((NULL == state) || (NULL == state->prebuiltTable) || (NULL == classData)) {
+		return NULL;
+	}
+
+	query.className = className;
+	query.classNameLength = classNameLength;
+	entry = hashTableFind(state->prebuiltTable, &query);
+	if ((NULL == entry) || (entry->classLoader != classLoader)) {
+		return NULL;
+	}
+
+	entryClassData = entry->classData;
+	entryClassDataLength = entry->classDataLength;
+	entryROMClass = entry->romClass;
+	entryBytes = entryClassDataLength + entryROMClass->romSize;
+	if ((entryClassDataLength == classDataLength)
+		&& (0 == memcmp(entryClassData, classData, classDataLength))
+		&& !isClassLoadHooked(vm)
+	) {
+		romClass = j9bcutil_copyRomClassIntoClassLoader(vm, classLoader, entryROMClass);
+	}
+	if (NULL != romClass) {
+		state->usedCount += 1;
+		Trc_BCU_findPrebuiltROMClass_Found(vmThread, classNameLength, className, romClass);
+	} else {
+		/* The class was defined from different bytes; the prebuilt ROMClass is abandoned */
+		state->discardedCount += 1;
+		Trc_BCU_findPrebuiltROMClass_Mismatch(vmThread, classNameLength, className, entryROMClass);
+	}
+	hashTableRemove(state->prebuiltTable, entry);
+	j9mem_free_memory(entryROMClass);
+	j9mem_free_memory(entryClassData);
+
+	omrthread_monitor_enter(state->mutex);
+	state->pendingBytes -= entryBytes;
+	omrthread_monitor_notify_all(state->mutex);
+	omrthread_monitor_exit(state->mutex);
+
+	return romClass;
+}
+
+/**
+ * Find a class on the application class path and read its class file bytes.
+ *
+ * @param[in] worker the worker thread data
+ * @param[in] className the class to read
+ * @param[out] length the length of the class file
+ * @return a newly allocated buffer holding the class file, or NULL if the class was not found
+ */
+static U_8 *
+readClassBytes(J9ROMClassPrebuildWorker *worker, J9ROMClassPrebuildName *className, UDATA *length)
+{
+	J9ROMClassPrebuildState *state = worker->state;
+	J9JavaVM *vm = state->javaVM;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+	U_8 *classData = NULL;
+	UDATA i = 0;
+
+	for (i = 0; (NULL == classData) && (i < state->classPathEntryCount); i++) {
+		if (state->classPathEntryIsDirectory[i]) {
+			j9str_printf(worker->pathBuffer, state->maxPathLength, "%s/%.*s.class",
+				state->classPathEntries[i], (U_32)className->length, className->name);
+			classData = readWholeFile(PORTLIB, worker->pathBuffer, length);
+		}
+#ifdef J9VM_OPT_ZIP_SUPPORT
+		else if (ZIP_STATE_FAILED != worker->zipStates[i]) {
+			VMI_ACCESS_FROM_JAVAVM((JavaVM *)vm);
+			VMIZipFunctionTable *zipFunctions = (*VMI)->GetZipFunctions(VMI);
+			VMIZipEntry entry;
+			UDATA nameLength = 0;
+
+			if (ZIP_STATE_UNOPENED == worker->zipStates[i]) {
+				if (0 == zipFunctions->zip_openZipFile(VMI, state->classPathEntries[i], &worker->zipFiles[i], ZIP_FLAG_OPEN_CACHE)) {
+					worker->zipStates[i] = ZIP_STATE_OPEN;
+				} else {
+					worker->zipStates[i] = ZIP_STATE_FAILED;
+					continue;
+				}
+			}
+
+			nameLength = j9str_printf(worker->pathBuffer, state->maxPathLength, "%.*s.class", (U_32)className->length, className->name);
+			zipFunctions->zip_initZipEntry(VMI, &entry);
+			if (0 == zipFunctions->zip_getZipEntryWithSize(VMI, &worker->zipFiles[i], &entry, worker->pathBuffer, nameLength, ZIP_FLAG_READ_DATA_POINTER)) {
+				classData = j9mem_allocate_memory(entry.uncompressedSize, J9MEM_CATEGORY_CLASSES);
+				if (NULL != classData) {
+					if (0 == zipFunctions->zip_getZipEntryData(VMI, &worker->zipFiles[i], &entry, classData, entry.uncompressedSize)) {
+						*length = entry.uncompressedSize;
+					} else {
+						j9mem_free_memory(classData);
+						classData = NULL;
+					}
+				}
+			}
+			zipFunctions->zip_freeZipEntry(VMI, &entry);
+		}
+#endif /* J9VM_OPT_ZIP_SUPPORT */
+	}
+
+	return classData;
+}
+
+/**
+ * Build the ROMClass for a class in the application class loader and record it for
+ * internalDefineClass(). Ownership of classData passes to this function.
+ *
+ * The class file is parsed and translated without holding the classTableMutex. The lock is only
+ * taken to check that the class has not been defined in the meantime and to publish the result.
+ */
+static void
+prebuildROMClass(J9VMThread *currentThread, J9ROMClassPrebuildState *state, J9ROMClassPrebuildName *className, U_8 *classData, UDATA classDataLength)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	J9InternalVMFunctions const *vmFuncs = vm->internalVMFunctions;
+	J9ClassLoader *classLoader = vm->applicationClassLoader;
+	J9ROMClassPrebuildEntry entry = {0};
+	J9LoadROMClassData loadData = {0};
+	J9ROMClass *romClass = NULL;
+	UDATA translationFlags = 0;
+	BOOLEAN recorded = FALSE;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	if ((NULL == classLoader) || isClassLoadHooked(vm)) {
+		j9mem_free_memory(classData);
+		return;
+	}
+
+	loadData.className = className->name;
+	loadData.classNameLength = className->length;
+	loadData.classData = classData;
+	loadData.classDataLength = classDataLength;
+	loadData.classLoader = classLoader;
+	translationFlags = getROMClassTranslationFlags(currentThread, &loadData);
+	if (NULL != vm->bytecodeVerificationData) {
+		translationFlags |= (vm->bytecodeVerificationData->verificationFlags & (J9_VERIFY_IGNORE_STACK_MAPS | J9_VERIFY_NO_FALLBACK));
+	}
+
+	/* Errors, including a class file for a different class, are reported again if and when the application defines the class */
+	j9bcutil_buildRomClassIntoScratch(vm, classLoader, className->name, className->length,
+			classData, classDataLength, translationFlags, vm->dynamicLoadBuffers->flags, &romClass);
+
+	if (NULL != romClass) {
+		entry.className = className->name;
+		entry.classNameLength = className->length;
+
+		vmFuncs->internalAcquireVMAccess(currentThread);
+		omrthread_monitor_enter(vm->classTableMutex);
+		if (!isClassLoadHooked(vm)
+			&& (NULL == vmFuncs->hashClassTableAt(classLoader, className->name, className->length, 0))
+			&& (NULL == hashTableFind(state->prebuiltTable, &entry))
+		) {
+			entry.classLoader = classLoader;
+			entry.romClass = romClass;
+			entry.classData = classData;
+			entry.classDataLength = classDataLength;
+			if (NULL != hashTableAdd(state->prebuiltTable, &entry)) {
+				recorded = TRUE;
+				state->builtCount += 1;
+				Trc_BCU_prebuildROMClass_Built(currentThread, className->length, className->name, romClass);
+				/* Account for the entry before findPrebuiltROMClass() can remove it */
+				omrthread_monitor_enter(state->mutex);
+				state->pendingBytes += classDataLength + romClass->romSize;
+				omrthread_monitor_exit(state->mutex);
+			}
+		}
+		omrthread_monitor_exit(vm->classTableMutex);
+		vmFuncs->internalReleaseVMAccess(currentThread);
+	}
+
+	if (!recorded) {
+		j9mem_free_memory(romClass);
+		j9mem_free_memory(classData);
+	}
+}
+
+static int J9THREAD_PROC
+prebuildWorkerThreadProc(void *entryArg)
+{
+	J9ROMClassPrebuildState *state = (J9ROMClassPrebuildState *)entryArg;
+	J9JavaVM *vm = state->javaVM;
+	J9VMThread *currentThread = NULL;
+	J9ROMClassPrebuildWorker worker = {0};
+	BOOLEAN ready = FALSE;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	worker.state = state;
+	worker.pathBuffer = j9mem_allocate_memory(state->maxPathLength, J9MEM_CATEGORY_CLASSES);
+	ready = (NULL != worker.pathBuffer);
+#ifdef J9VM_OPT_ZIP_SUPPORT
+	worker.zipFiles = j9mem_allocate_memory(state->classPathEntryCount * (sizeof(VMIZipFile) + sizeof(U_8)), J9MEM_CATEGORY_CLASSES);
+	if (NULL != worker.zipFiles) {
+		worker.zipStates = (U_8 *)(worker.zipFiles + state->classPathEntryCount);
+		memset(worker.zipStates, ZIP_STATE_UNOPENED, state->classPathEntryCount);
+	} else {
+		ready = FALSE;
+	}
+#endif /* J9VM_OPT_ZIP_SUPPORT */
+
+	if (ready && (JNI_OK == vm->internalVMFunctions->attachSystemDaemonThread(vm, &currentThread, "ROMClass prebuilder"))) {
+		omrthread_monitor_enter(state->mutex);
+		/* The application class loader is created while the class library initializes */
+		while ((J9_ROMCLASS_PREBUILD_STATE_STOP != state->state) && (NULL == vm->applicationClassLoader)) {
+			omrthread_monitor_wait_timed(state->mutex, 10, 0);
+		}
+		for (;;) {
+			J9ROMClassPrebuildName *className = NULL;
+			U_8 *classData = NULL;
+			UDATA classDataLength = 0;
+
+			while ((J9_ROMCLASS_PREBUILD_STATE_STOP != state->state) && (state->pendingBytes >= J9_ROMCLASS_PREBUILD_MAX_PENDING_BYTES)) {
+				omrthread_monitor_wait(state->mutex);
+			}
+			if ((J9_ROMCLASS_PREBUILD_STATE_STOP == state->state) || (state->nextClassIndex >= state->classCount)) {
+				break;
+			}
+			className = &state->classNames[state->nextClassIndex];
+			state->nextClassIndex += 1;
+			omrthread_monitor_exit(state->mutex);
+
+			classData = readClassBytes(&worker, className, &classDataLength);
+			if (NULL != classData) {
+				prebuildROMClass(currentThread, state, className, classData, classDataLength);
+			}
+
+			omrthread_monitor_enter(state->mutex);
+		}
+		omrthread_monitor_exit(state->mutex);
+		(*(JavaVM *)vm)->DetachCurrentThread((JavaVM *)vm);
+	}
+
+#ifdef J9VM_OPT_ZIP_SUPPORT
+	if (NULL != worker.zipFiles) {
+		VMI_ACCESS_FROM_JAVAVM((JavaVM *)vm);
+		UDATA i = 0;
+		for (i = 0; i < state->classPathEntryCount; i++) {
+			if (ZIP_STATE_OPEN == worker.zipStates[i]) {
+				(*VMI)->GetZipFunctions(VMI)->zip_closeZipFile(VMI, &worker.zipFiles[i]);
+			}
+		}
+		j9mem_free_memory(worker.zipFiles);
+	}
+#endif /* J9VM_OPT_ZIP_SUPPORT */
+	j9mem_free_memory(worker.pathBuffer);
+
+	omrthread_monitor_enter(state->mutex);
+	state->activeThreads -= 1;
+	omrthread_monitor_notify_all(state->mutex);
+	omrthread_exit(state->mutex);
+
+	/* NO GUARANTEED EXECUTION BEYOND THIS POINT */
+
+	return 0;
+}
+
+#endif /* J9VM_OPT_DYNAMIC_LOAD_SUPPORT */ /* End File Level Build Flags */
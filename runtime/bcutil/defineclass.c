@@ -140,6 +140,14 @@ internalDefineClass(
 
 			}
 		}
+
+		/* See if the ROMClass was built ahead of time from the same bytes - still own classTableMutex at this point */
+		if ((NULL == loadData.romClass)
+			&& (NULL != vm->dynamicLoadBuffers->romClassPrebuilder)
+			&& J9_ARE_NO_BITS_SET(options, ~(UDATA)(J9_FINDCLASS_FLAG_THROW_ON_FAIL | J9_FINDCLASS_FLAG_NO_CHECK_FOR_EXISTING_CLASS))
+		) {
+			romClass = findPrebuiltROMClass(vmThread, classLoader, className, classNameLength, classData, classDataLength);
+		}
 	}
 
 	if (NULL == romClass) {
@@ -481,85 +489,7 @@ internalLoadROMClass(J9VMThread * vmThread, J9LoadROMClassData *loadData, J9Tran
 		}
 	}
 
-	/* Set up translation flags */
-
-#ifdef J9VM_ENV_LITTLE_ENDIAN
-	translationFlags = BCT_LittleEndianOutput;
-#else
-	translationFlags = BCT_BigEndianOutput;
-#endif
-
-	/*
-	 * RECORD_ALL is set by shared classes when it wishes to keep all debug information in the cache
-	 * classCouldPossiblyBeShared() returns true when the classloader is a shared classes enabled loader AND the cache is NOT full
-	 *
-	 * do NOT attempt to strip debug information when RECORD_ALL is set AND the class could end up the cache.
-	 *
-	 */
-	if ((J9VM_DEBUG_ATTRIBUTE_RECORD_ALL == (vm->requiredDebugAttributes & J9VM_DEBUG_ATTRIBUTE_RECORD_ALL))
-			&& classCouldPossiblyBeShared(vmThread, loadData)) {
-		/* Shared Classes has requested that all debug information be kept and the class will be shared. */
-	} else if (0 != (vm->runtimeFlags & J9_RUNTIME_XFUTURE)) {
-		/* Don't strip debug information with Xfuture */
-	} else {
-		/* either the class is not going to be shared  -or- shared classes does not require the debug information to be maintained */
-		UDATA stripFlags = 0;
-
-		if (0 == (vm->requiredDebugAttributes & J9VM_DEBUG_ATTRIBUTE_LOCAL_VARIABLE_TABLE)) {
-			stripFlags |= BCT_StripDebugVars;
-		}
-		if (0 == (vm->requiredDebugAttributes & J9VM_DEBUG_ATTRIBUTE_LINE_NUMBER_TABLE)) {
-			stripFlags |= BCT_StripDebugLines;
-		}
-		if (0 == (vm->requiredDebugAttributes & J9VM_DEBUG_ATTRIBUTE_SOURCE_FILE)) {
-			stripFlags |= BCT_StripDebugSource;
-		}
-		if (0 == (vm->requiredDebugAttributes & J9VM_DEBUG_ATTRIBUTE_SOURCE_DEBUG_EXTENSION)) {
-			stripFlags |= BCT_StripSourceDebugExtension;
-		}
-
-		if (stripFlags == (BCT_StripDebugVars | BCT_StripDebugLines | BCT_StripDebugSource | BCT_StripSourceDebugExtension)) {
-			stripFlags = BCT_StripDebugAttributes;
-		}
-		translationFlags |= stripFlags;
-	}
-
-	if (J9_ARE_ANY_BITS_SET(vm->runtimeFlags, J9_RUNTIME_VERIFY)) {
-		translationFlags |= BCT_StaticVerification;
-	}
-
-	if (0 != (vm->runtimeFlags & J9_RUNTIME_XFUTURE)) {
-		translationFlags |= BCT_Xfuture;
-	} else {
-		/* Disable static verification for the bootstrap loader if Xfuture not present */
-		if ((vm->systemClassLoader == loadData->classLoader)
-		&& ((NULL == vm->bytecodeVerificationData) || (0 == (vm->bytecodeVerificationData->verificationFlags & J9_VERIFY_BOOTCLASSPATH_STATIC)))
-		&& (NULL == vm->sharedClassConfig)
-		) {
-			translationFlags &= ~BCT_StaticVerification;
-		}
-	}
-
-	if (J9_ARE_ANY_BITS_SET(vm->runtimeFlags, J9_RUNTIME_ALWAYS_SPLIT_BYTECODES)) {
-		translationFlags |= BCT_AlwaysSplitBytecodes;
-	}
-	if (J9_ARE_ANY_BITS_SET(vm->extendedRuntimeFlags2, J9_EXTENDED_RUNTIME2_ENABLE_PREVIEW)) {
-		translationFlags |= BCT_EnablePreview;
-	}
-#if (JAVA_SPEC_VERSION == 8) && defined(J9ZOS390) && defined(J9VM_ENV_DATA64)
-	/* This code duplication is intentional, it works around a JDK8 z/OS 64bit (non-compressedrefs) compiler issue, RTC 147197. */
-	if (J9_ARE_ANY_BITS_SET(vm->extendedRuntimeFlags2, J9_EXTENDED_RUNTIME2_ENABLE_PREVIEW)) {
-		translationFlags |= BCT_EnablePreview;
-	}
-#endif
-	/* Determine allowed class file version */
-#ifdef J9VM_OPT_SIDECAR
-	{
-		/* Using local variable majorVer avoids a z/OS 64-bit compiler issue. */
-		U_32 majorVer = BCT_JavaMaxMajorVersionShifted;
-		translationFlags |= majorVer;
-	}
-#endif
+	translationFlags = getROMClassTranslationFlags(vmThread, loadData);
 
 	/* TODO toss tracepoint?? Trc_BCU_internalLoadROMClass_AttemptExisting(vmThread, segment, romAvailable, bytesRequired); */
 	/* Attempt dynamic load */
@@ -668,6 +598,100 @@ done:
 	return result;
 }
 
+/**
+ * Compute the translation flags for building the ROMClass of a class defined with loadData.
+ *
+ * @param[in] vmThread the current J9VMThread
+ * @param[in] loadData the class being loaded
+ * @return the BCT_* translation flags
+ */
+UDATA
+getROMClassTranslationFlags(J9VMThread *vmThread, J9LoadROMClassData *loadData)
+{
+	J9JavaVM *vm = vmThread->javaVM;
+	UDATA translationFlags = 0;
+
+#ifdef J9VM_ENV_LITTLE_ENDIAN
+	translationFlags = BCT_LittleEndianOutput;
+#else
+	translationFlags = BCT_BigEndianOutput;
+#endif
+
+	/*
+	 * RECORD_ALL is set by shared classes when it wishes to keep all debug information in the cache
+	 * classCouldPossiblyBeShared() returns true when the classloader is a shared classes enabled loader AND the cache is NOT full
+	 *
+	 * do NOT attempt to strip debug information when RECORD_ALL is set AND the class could end up the cache.
+	 *
+	 */
+	if ((J9VM_DEBUG_ATTRIBUTE_RECORD_ALL == (vm->requiredDebugAttributes & J9VM_DEBUG_ATTRIBUTE_RECORD_ALL))
+			&& classCouldPossiblyBeShared(vmThread, loadData)) {
+		/* Shared Classes has requested that all debug information be kept and the class will be shared. */
+	} else if (0 != (vm->runtimeFlags & J9_RUNTIME_XFUTURE)) {
+		/* Don't strip debug information with Xfuture */
+	} else {
+		/* either the class is not going to be shared  -or- shared classes does not require the debug information to be maintained */
+		UDATA stripFlags = 0;
+
+		if (0 == (vm->requiredDebugAttributes & J9VM_DEBUG_ATTRIBUTE_LOCAL_VARIABLE_TABLE)) {
+			stripFlags |= BCT_StripDebugVars;
+		}
+		if (0 == (vm->requiredDebugAttributes & J9VM_DEBUG_ATTRIBUTE_LINE_NUMBER_TABLE)) {
+			stripFlags |= BCT_StripDebugLines;
+		}
+		if (0 == (vm->requiredDebugAttributes & J9VM_DEBUG_ATTRIBUTE_SOURCE_FILE)) {
+			stripFlags |= BCT_StripDebugSource;
+		}
+		if (0 == (vm->requiredDebugAttributes & J9VM_DEBUG_ATTRIBUTE_SOURCE_DEBUG_EXTENSION)) {
+			stripFlags |= BCT_StripSourceDebugExtension;
+		}
+
+		if (stripFlags == (BCT_StripDebugVars | BCT_StripDebugLines | BCT_StripDebugSource | BCT_StripSourceDebugExtension)) {
+			stripFlags = BCT_StripDebugAttributes;
+		}
+		translationFlags |= stripFlags;
+	}
+
+	if (J9_ARE_ANY_BITS_SET(vm->runtimeFlags, J9_RUNTIME_VERIFY)) {
+		translationFlags |= BCT_StaticVerification;
+	}
+
+	if (0 != (vm->runtimeFlags & J9_RUNTIME_XFUTURE)) {
+		translationFlags |= BCT_Xfuture;
+	} else {
+		/* Disable static verification for the bootstrap loader if Xfuture not present */
+		if ((vm->systemClassLoader == loadData->classLoader)
+		&& ((NULL == vm->bytecodeVerificationData) || (0 == (vm->bytecodeVerificationData->verificationFlags & J9_VERIFY_BOOTCLASSPATH_STATIC)))
+		&& (NULL == vm->sharedClassConfig)
+		) {
+			translationFlags &= ~BCT_StaticVerification;
+		}
+	}
+
+	if (J9_ARE_ANY_BITS_SET(vm->runtimeFlags, J9_RUNTIME_ALWAYS_SPLIT_BYTECODES)) {
+		translationFlags |= BCT_AlwaysSplitBytecodes;
+	}
+	if (J9_ARE_ANY_BITS_SET(vm->extendedRuntimeFlags2, J9_EXTENDED_RUNTIME2_ENABLE_PREVIEW)) {
+		translationFlags |= BCT_EnablePreview;
+	}
+#if (JAVA_SPEC_VERSION == 8) && defined(J9ZOS390) && defined(J9VM_ENV_DATA64)
+	/* This code duplication is intentional, it works around a JDK8 z/OS 64bit (non-compressedrefs) compiler issue, RTC 147197. */
+	if (J9_ARE_ANY_BITS_SET(vm->extendedRuntimeFlags2, J9_EXTENDED_RUNTIME2_ENABLE_PREVIEW)) {
+		translationFlags |= BCT_EnablePreview;
+	}
+#endif
+	/* Determine allowed class file version */
+#ifdef J9VM_OPT_SIDECAR
+	{
+		/* Using local variable majorVer avoids a z/OS 64-bit compiler issue. */
+		U_32 majorVer = BCT_JavaMaxMajorVersionShifted;
+		translationFlags |= majorVer;
+	}
+#endif
+
+	return translationFlags;
+}
+
 static UDATA
 callDynamicLoader(J9VMThread *vmThread, J9LoadROMClassData *loadData, U_8 * intermediateClassData, UDATA intermediateClassDataLength, UDATA translationFlags, UDATA classFileBytesReplacedByRIA, UDATA classFileBytesReplacedByRCA, J9TranslationLocalBuffer *localBuffer)
 {
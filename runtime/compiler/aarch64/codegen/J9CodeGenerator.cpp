@@ -87,6 +87,11 @@ J9::ARM64::CodeGenerator::initialize()
       {
       cg->setSupportsInlineStringHashCode();
       }
+   static bool disableInlineVectorHashCode = feGetEnv("TR_disableInlineVectorHashCode") != NULL;
+   if ((!TR::Compiler->om.canGenerateArraylets()) && (!disableInlineVectorHashCode))
+      {
+      cg->setSupportsInlineVectorizedHashCode();
+      }
    if ((!TR::Compiler->om.canGenerateArraylets()) && (!comp->getOption(TR_DisableFastStringIndexOf)))
       {
       cg->setSupportsInlineStringIndexOf();
@@ -6026,15 +6026,36 @@ static TR::Register *inlineCRC32CUpdateBytes(TR::Node *node, TR::CodeGenerator *
    }
 
 /**
- * @brief Generates vectorized instruction sequence for computing hashcode of a String
+ * @brief Generates sxtl(2) or uxtl(2) instruction widening the lower or upper half of a vector register
  *
+ * @param[in] cg: CodeGenerator
+ * @param[in] elementType: element type of the source register (Int8 or Int16)
+ * @param[in] isSigned: true for sign extension
  * @param[in] node: node
- * @param[in] isCompressed: true if compressed string
+ * @param[in] treg: target register
+ * @param[in] sreg: source register
+ * @param[in] isUpperHalf: true to widen the upper half (sxtl2/uxtl2)
+ *
+ * @returns instruction
+ */
+static TR::Instruction *generateVectorExtendLongInstruction(TR::CodeGenerator *cg, TR::DataType elementType, bool isSigned, TR::Node *node, TR::Register *treg, TR::Register *sreg, bool isUpperHalf)
+   {
+   return isSigned ? generateVectorSXTLInstruction(cg, elementType, node, treg, sreg, isUpperHalf)
+                   : generateVectorUXTLInstruction(cg, elementType, node, treg, sreg, isUpperHalf);
+   }
+
+/**
+ * @brief Generates vectorized instruction sequence for computing hashcode of a range of array elements
+ *
+ * @param[in] node: node
+ * @param[in] elementType: Int8, Int16 or Int32
+ * @param[in] isSigned: true if Int8 or Int16 elements are sign extended
+ * @param[in] initialValueNode: node of the initial hash value, or NULL for String hashcode
  * @param[in] cg: CodeGenerator
  *
  * @returns register
  */
-static TR::Register *inlineStringHashCode(TR::Node *node, bool isCompressed, TR::CodeGenerator *cg)
+static TR::Register *hashCodeHelper(TR::Node *node, TR::DataType elementType, bool isSigned, TR::Node *initialValueNode, TR::CodeGenerator *cg)
    {
    /*
     *    str[16] = example string representing 16 compressed characters
@@ -6091,8 +6112,14 @@ static TR::Register *inlineStringHashCode(TR::Node *node, bool isCompressed, TR:
     *    If the number of characters in the string is not a multiple of 16 (or 8 in the case of decompressed String),
     *    then the remainder of the hash is calculated serially.
     *
+    *    int elements are hashed 8 per iteration like decompressed characters, but are loaded without widening.
+    *    A non-zero initial hash value is put in the last lane of vtmp2Reg before the loop. That lane is multiplied
+    *    by 31^8 (or 31^16) in every iteration and by 1 at the end, which gives initialValue * 31^(vectorized length).
+    *    Signed byte and short elements are widened with sxtl/sxtl2 in place of uxtl/uxtl2.
+    *
     *    addx dataAddrReg, addressReg, #headersize
-    *    movz resultReg, #0
+    *    addx dataAddrReg, dataAddrReg, offsetReg, lsl #(0, 1 or 2)    ; if offset is not 0
+    *    movz resultReg, #0                                             ; or mov resultReg, initialValueReg
     *    cmpw lengthReg, #(8 or 16)
     *    b.lt residual
     *    sub lengthReg, lengthReg, #(8 or 16)
@@ -6100,21 +6127,27 @@ static TR::Register *inlineStringHashCode(TR::Node *node, bool isCompressed, TR:
     *    ldr vMultiplier4Reg, multiplier4
     *    mul vMultiplier8Reg.4s, vMultiplier4Reg.4s, vMultiplier4Reg.4s ; 31^8
     *    movi vtmp1Reg.16b, #0
-    *    movi vtmp2Reg.16b, #0
+    *    movi vtmp2Reg.16b, #0                                          ; or dup vtmp2Reg.4s, initialValueReg
+    *                                                                   ;    mul vtmp2Reg.4s, vtmp2Reg.4s, lastLane.4s
     * LOOP:
     *    subs lengthReg, lengthReg, #(8 or 16)
+    * if int
+    *    ldr vtmp4Reg, [dataAddrReg], #16
+    *    ldr vtmp5Reg, [dataAddrReg], #16
+    * else
     *    ldr vtmp3Reg, [dataAddrReg], #16
+    * fi
     *
-    * if decompressed
-    *    uxtl vtmp4Reg.4s, vtmp3Reg.4h
-    *    uxtl2 vtmp5Reg.4s, vtmp3Reg.8h
+    * if decompressed, short or int
+    *    uxtl vtmp4Reg.4s, vtmp3Reg.4h                                  ; decompressed or short only, sxtl if signed
+    *    uxtl2 vtmp5Reg.4s, vtmp3Reg.8h                                 ; decompressed or short only, sxtl2 if signed
     *    ; (1) Vector0[k] = str[k] -> multiply 31^8 -> add str[k+8]
     *    mla vtmp4Reg.4s, vtmp1Reg.4s, vMultiplier8Reg.4s
     *    mov vtmp1Reg.16b, vtmp4Reg.16b
     *    ; (2) Vector1[k] = str[k+4] -> multiply 31^8 -> add str[k+12]
     *    mla vtmp5Reg.4s, vtmp2Reg.4s, vMultiplier8Reg.4s
     *    mov vtmp2Reg.16b, vtmp5Reg.16b
-    * else ; compressed
+    * else ; compressed or byte, sxtl/sxtl2 in place of uxtl/uxtl2 if signed
     *    uxtl vtmp4Reg.8h, vtmp3Reg.8b
     *    uxtl2 vtmp5Reg.8h, vtmp3Reg.16b
     *    uxtl vtmp6Reg.4s, vtmp4Reg.4h
@@ -6143,9 +6176,12 @@ static TR::Register *inlineStringHashCode(TR::Node *node, bool isCompressed, TR:
     *    subws lengthReg, lengthReg, #1
     * if decompressed
     *    ldrh dataReg, [dataAddrReg], #2
+    * else if int
+    *    ldr dataReg, [dataAddrReg], #4
     * else ; compressed
     *    ldrb dataReg, [dataAddrReg], #1
     * fi
+    *    sxtb/sxth dataReg, dataReg                                     ; signed byte and short only
     *    addw dataReg, dataReg, resultReg, lsl #5
     *    subw resultReg, dataReg, resultReg
     *    b.gt residual
@@ -6158,16 +6194,29 @@ static TR::Register *inlineStringHashCode(TR::Node *node, bool isCompressed, TR:
     * multiplier4:
     *    .dword 0x000e1781000e1781 ; 31^4
     *    .dword 0x000e1781000e1781
+    * lastLane:
+    *    .dword 0x0000000000000000
+    *    .dword 0x0000000100000000
     *
     */
 
-   /*
-    * We omit to evaluate the second child because it is always 0.
-    */
    TR::Node *arrayNode = node->getFirstChild();
+   TR::Node *offsetNode = node->getSecondChild();
    TR::Node *lengthNode = node->getThirdChild();
+   const bool isOffsetConstZero = offsetNode->isConstZeroValue();
+   const bool hasInitialValue = (initialValueNode != NULL) && !initialValueNode->isConstZeroValue();
+   const int32_t elementShift = (elementType == TR::Int8) ? 0 : ((elementType == TR::Int16) ? 1 : 2);
+   const int32_t elementsPerIteration = (elementType == TR::Int8) ? 16 : 8;
+   /*
+    * String.hashCodeImpl is never called for an empty String, but ArraysSupport.vectorizedHashCode can be called with an empty range.
+    */
+   const bool checkEmptyRange = (initialValueNode != NULL);
+   const char *counterName = (initialValueNode != NULL) ? "VectorizedHashCode" : "StringHashCode";
+
    TR::Register *arrayReg = cg->evaluate(arrayNode);
+   TR::Register *offsetReg = isOffsetConstZero ? NULL : cg->evaluate(offsetNode);
    TR::Register *savedLengthReg = cg->evaluate(lengthNode);
+   TR::Register *initialValueReg = hasInitialValue ? cg->evaluate(initialValueNode) : NULL;
    TR_ARM64ScratchRegisterManager *srm = cg->generateScratchRegisterManager(12);
    TR::Register *dataAddrReg = (arrayNode->getReferenceCount() > 1) ? srm->findOrCreateScratchRegister() : arrayReg;
    TR::Register *lengthReg = (lengthNode->getReferenceCount() > 1) ? srm->findOrCreateScratchRegister() : savedLengthReg;
@@ -6180,7 +6229,8 @@ static TR::Register *inlineStringHashCode(TR::Node *node, bool isCompressed, TR:
    TR::Compilation *comp = cg->comp();
    if (comp->getOptions()->enableDebugCounters())
       {
-      cg->generateDebugCounter(TR::DebugCounter::debugCounterName(comp, "cg.StringHashCode/(%s)/%s",
+      cg->generateDebugCounter(TR::DebugCounter::debugCounterName(comp, "cg.%s/(%s)/%s",
+                                                                        counterName,
                                                                         comp->signature(),
                                                                         comp->getHotnessName()), *srm);
       }
@@ -6196,18 +6246,44 @@ static TR::Register *inlineStringHashCode(TR::Node *node, bool isCompressed, TR:
       {
       generateTrg1Src1ImmInstruction(cg, TR::InstOpCode::addimmx, node, dataAddrReg, arrayReg, TR::Compiler->om.contiguousArrayHeaderSizeInBytes());
       }
+   if (!isOffsetConstZero)
+      {
+      if (elementShift == 0)
+         {
+         generateTrg1Src2Instruction(cg, TR::InstOpCode::addx, node, dataAddrReg, dataAddrReg, offsetReg);
+         }
+      else
+         {
+         generateTrg1Src2ShiftedInstruction(cg, TR::InstOpCode::addx, node, dataAddrReg, dataAddrReg, offsetReg, TR::SH_LSL, elementShift);
+         }
+      }
+
+   if (hasInitialValue)
+      {
+      generateMovInstruction(cg, node, resultReg, initialValueReg, false);
+      }
+   else
+      {
+      loadConstant32(cg, node, 0, resultReg);
+      }
 
-   loadConstant32(cg, node, 0, resultReg);
-   generateCompareImmInstruction(cg, node, lengthReg, (isCompressed ? 16 : 8), false);
    TR::LabelSymbol *residualLabel = generateLabelSymbol(cg);
+   TR::LabelSymbol *doneLabel = generateLabelSymbol(cg);
+   if (checkEmptyRange)
+      {
+      generateCompareBranchInstruction(cg, TR::InstOpCode::cbzw, node, lengthReg, doneLabel);
+      }
+
+   generateCompareImmInstruction(cg, node, lengthReg, elementsPerIteration, false);
    generateConditionalBranchInstruction(cg, node, residualLabel, TR::CC_LT);
    if (comp->getOptions()->enableDebugCounters())
       {
-      cg->generateDebugCounter(TR::DebugCounter::debugCounterName(comp, "cg.StringHashCode/(%s)/%s:long",
+      cg->generateDebugCounter(TR::DebugCounter::debugCounterName(comp, "cg.%s/(%s)/%s:long",
+                                                                        counterName,
                                                                         comp->signature(),
                                                                         comp->getHotnessName()), *srm);
       }
-   generateTrg1Src1ImmInstruction(cg, TR::InstOpCode::subimmw, node, lengthReg, lengthReg, (isCompressed ? 16 : 8));
+   generateTrg1Src1ImmInstruction(cg, TR::InstOpCode::subimmw, node, lengthReg, lengthReg, elementsPerIteration);
    TR::Register *multiplierReg = srm->findOrCreateScratchRegister(TR_VRF);
    {
       static uint32_t multiplier[] = { 31*31*31, 31*31, 31, 1 };
@@ -6226,38 +6302,59 @@ static TR::Register *inlineStringHashCode(TR::Node *node, bool isCompressed, TR:
    generateTrg1Src2Instruction(cg, TR::InstOpCode::vmul4s, node, multiplier8Reg, multiplier4Reg, multiplier4Reg);
    TR::Register *vtmp1Reg = srm->findOrCreateScratchRegister(TR_VRF);
    TR::Register *vtmp2Reg = srm->findOrCreateScratchRegister(TR_VRF);
+   TR::Register *vtmp3Reg = srm->findOrCreateScratchRegister(TR_VRF);
    generateTrg1ImmInstruction(cg, TR::InstOpCode::vmovi4s, node, vtmp1Reg, 0);
-   generateTrg1ImmInstruction(cg, TR::InstOpCode::vmovi4s, node, vtmp2Reg, 0);
+   if (hasInitialValue)
+      {
+      static uint32_t lastLane[] = { 0, 0, 0, 1 };
+      auto snippet = cg->findOrCreateConstantDataSnippet(node, lastLane, sizeof(lastLane));
+      TR::LabelSymbol *lastLaneLabel = snippet->getSnippetLabel();
+      generateTrg1ImmSymInstruction(cg, TR::InstOpCode::vldrq, node, vtmp3Reg, 0, lastLaneLabel);
+      generateTrg1Src1Instruction(cg, TR::InstOpCode::vdup4s, node, vtmp2Reg, initialValueReg);
+      generateTrg1Src2Instruction(cg, TR::InstOpCode::vmul4s, node, vtmp2Reg, vtmp2Reg, vtmp3Reg);
+      }
+   else
+      {
+      generateTrg1ImmInstruction(cg, TR::InstOpCode::vmovi4s, node, vtmp2Reg, 0);
+      }
 
    /*
-    * Main loop: 16 bytes are processed in 1 iteration of the loop.
+    * Main loop: 16 bytes (32 bytes for int elements) are processed in 1 iteration of the loop.
     */
    TR::LabelSymbol *loopLabel = generateLabelSymbol(cg);
-   TR::Register *vtmp3Reg = srm->findOrCreateScratchRegister(TR_VRF);
    generateLabelInstruction(cg, TR::InstOpCode::label, node, loopLabel);
-   generateTrg1Src1ImmInstruction(cg, TR::InstOpCode::subsimmw, node, lengthReg, lengthReg, (isCompressed ? 16 : 8));
-   generateTrg1MemInstruction(cg, TR::InstOpCode::vldrpostq, node, vtmp3Reg, TR::MemoryReference::createWithDisplacement(cg, dataAddrReg, 16));
+   generateTrg1Src1ImmInstruction(cg, TR::InstOpCode::subsimmw, node, lengthReg, lengthReg, elementsPerIteration);
 
    TR::Register *vtmp4Reg = srm->findOrCreateScratchRegister(TR_VRF);
    TR::Register *vtmp5Reg = srm->findOrCreateScratchRegister(TR_VRF);
-   if (isCompressed)
+   if (elementType == TR::Int8)
       {
       TR::Register *vtmp6Reg = srm->findOrCreateScratchRegister(TR_VRF);
-      generateVectorUXTLInstruction(cg, TR::Int8, node, vtmp4Reg, vtmp3Reg, false);
-      generateVectorUXTLInstruction(cg, TR::Int8, node, vtmp5Reg, vtmp3Reg, true);
-      generateVectorUXTLInstruction(cg, TR::Int16, node, vtmp6Reg, vtmp4Reg, false);
-      generateVectorUXTLInstruction(cg, TR::Int16, node, vtmp3Reg, vtmp4Reg, true);
+      generateTrg1MemInstruction(cg, TR::InstOpCode::vldrpostq, node, vtmp3Reg, TR::MemoryReference::createWithDisplacement(cg, dataAddrReg, 16));
+      generateVectorExtendLongInstruction(cg, TR::Int8, isSigned, node, vtmp4Reg, vtmp3Reg, false);
+      generateVectorExtendLongInstruction(cg, TR::Int8, isSigned, node, vtmp5Reg, vtmp3Reg, true);
+      generateVectorExtendLongInstruction(cg, TR::Int16, isSigned, node, vtmp6Reg, vtmp4Reg, false);
+      generateVectorExtendLongInstruction(cg, TR::Int16, isSigned, node, vtmp3Reg, vtmp4Reg, true);
       generateTrg1Src2Instruction(cg, TR::InstOpCode::vmla4s, node, vtmp6Reg, vtmp1Reg, multiplier8Reg);
-      generateVectorUXTLInstruction(cg, TR::Int16, node, vtmp1Reg, vtmp5Reg, false);
+      generateVectorExtendLongInstruction(cg, TR::Int16, isSigned, node, vtmp1Reg, vtmp5Reg, false);
       generateTrg1Src2Instruction(cg, TR::InstOpCode::vmla4s, node, vtmp3Reg, vtmp2Reg, multiplier8Reg);
-      generateVectorUXTLInstruction(cg, TR::Int16, node, vtmp2Reg, vtmp5Reg, true);
+      generateVectorExtendLongInstruction(cg, TR::Int16, isSigned, node, vtmp2Reg, vtmp5Reg, true);
       generateTrg1Src2Instruction(cg, TR::InstOpCode::vmla4s, node, vtmp1Reg, vtmp6Reg, multiplier8Reg);
       generateTrg1Src2Instruction(cg, TR::InstOpCode::vmla4s, node, vtmp2Reg, vtmp3Reg, multiplier8Reg);
       }
    else
       {
-      generateVectorUXTLInstruction(cg, TR::Int16, node, vtmp4Reg, vtmp3Reg, false);
-      generateVectorUXTLInstruction(cg, TR::Int16, node, vtmp5Reg, vtmp3Reg, true);
+      if (elementType == TR::Int16)
+         {
+         generateTrg1MemInstruction(cg, TR::InstOpCode::vldrpostq, node, vtmp3Reg, TR::MemoryReference::createWithDisplacement(cg, dataAddrReg, 16));
+         generateVectorExtendLongInstruction(cg, TR::Int16, isSigned, node, vtmp4Reg, vtmp3Reg, false);
+         generateVectorExtendLongInstruction(cg, TR::Int16, isSigned, node, vtmp5Reg, vtmp3Reg, true);
+         }
+      else
+         {
+         generateTrg1MemInstruction(cg, TR::InstOpCode::vldrpostq, node, vtmp4Reg, TR::MemoryReference::createWithDisplacement(cg, dataAddrReg, 16));
+         generateTrg1MemInstruction(cg, TR::InstOpCode::vldrpostq, node, vtmp5Reg, TR::MemoryReference::createWithDisplacement(cg, dataAddrReg, 16));
+         }
       generateTrg1Src2Instruction(cg, TR::InstOpCode::vmla4s, node, vtmp4Reg, vtmp1Reg, multiplier8Reg);
       generateTrg1Src2Instruction(cg, TR::InstOpCode::vorr16b, node, vtmp1Reg, vtmp4Reg, vtmp4Reg); /* mov vtmp1Reg.16b, vtmp4Reg.16b */
       generateTrg1Src2Instruction(cg, TR::InstOpCode::vmla4s, node, vtmp5Reg, vtmp2Reg, multiplier8Reg);
@@ -6268,34 +6365,121 @@ static TR::Register *inlineStringHashCode(TR::Node *node, bool isCompressed, TR:
    generateTrg1Src2Instruction(cg, TR::InstOpCode::vmul4s, node, vtmp1Reg, vtmp2Reg, multiplierReg);
    generateTrg1Src1Instruction(cg, TR::InstOpCode::vaddv4s, node, vtmp1Reg, vtmp1Reg);
    generateMovVectorElementToGPRInstruction(cg, TR::InstOpCode::umovws, node, resultReg, vtmp1Reg, 0);
-   generateTrg1Src1ImmInstruction(cg, TR::InstOpCode::addsimmw, node, lengthReg, lengthReg, (isCompressed ? 16 : 8));
-
-   TR::LabelSymbol *doneLabel = generateLabelSymbol(cg);
+   generateTrg1Src1ImmInstruction(cg, TR::InstOpCode::addsimmw, node, lengthReg, lengthReg, elementsPerIteration);
    generateConditionalBranchInstruction(cg, node, doneLabel, TR::CC_EQ);
 
    /* the remainder of the hash is calculated serially. */
    generateLabelInstruction(cg, TR::InstOpCode::label, node, residualLabel);
    generateTrg1Src1ImmInstruction(cg, TR::InstOpCode::subsimmw, node, lengthReg, lengthReg, 1);
    TR::Register *dataReg = srm->findOrCreateScratchRegister();
-   generateTrg1MemInstruction(cg, (isCompressed ? TR::InstOpCode::ldrbpost : TR::InstOpCode::ldrhpost), node, dataReg,
-                              TR::MemoryReference::createWithDisplacement(cg, dataAddrReg, (isCompressed ? 1 : 2)));
+   TR::InstOpCode::Mnemonic loadOp = (elementType == TR::Int8) ? TR::InstOpCode::ldrbpost :
+                                     ((elementType == TR::Int16) ? TR::InstOpCode::ldrhpost : TR::InstOpCode::ldrpostw);
+   generateTrg1MemInstruction(cg, loadOp, node, dataReg, TR::MemoryReference::createWithDisplacement(cg, dataAddrReg, 1 << elementShift));
+   if (isSigned && (elementType != TR::Int32))
+      {
+      // sxtb or sxth
+      generateTrg1Src1ImmInstruction(cg, TR::InstOpCode::sbfmw, node, dataReg, dataReg, (elementType == TR::Int8) ? 7 : 0xf);
+      }
    generateTrg1Src2ShiftedInstruction(cg, TR::InstOpCode::addw, node, dataReg, dataReg, resultReg, TR::SH_LSL, 5);
    generateTrg1Src2Instruction(cg, TR::InstOpCode::subw, node, resultReg, dataReg, resultReg);
    generateConditionalBranchInstruction(cg, node, residualLabel, TR::CC_GT);
 
-   TR::RegisterDependencyConditions *conditions = new (cg->trHeapMemory()) TR::RegisterDependencyConditions(0, 3 + srm->numAvailableRegisters(), cg->trMemory());
+   TR::RegisterDependencyConditions *conditions = new (cg->trHeapMemory()) TR::RegisterDependencyConditions(0,
+      3 + (offsetReg ? 1 : 0) + (initialValueReg ? 1 : 0) + srm->numAvailableRegisters(), cg->trMemory());
    conditions->addPostCondition(arrayReg, TR::RealRegister::NoReg);
    conditions->addPostCondition(savedLengthReg, TR::RealRegister::NoReg);
    conditions->addPostCondition(resultReg, TR::RealRegister::NoReg);
+   if (offsetReg)
+      {
+      conditions->addPostCondition(offsetReg, TR::RealRegister::NoReg);
+      }
+   if (initialValueReg)
+      {
+      conditions->addPostCondition(initialValueReg, TR::RealRegister::NoReg);
+      }
    srm->addScratchRegistersToDependencyList(conditions);
    generateLabelInstruction(cg, TR::InstOpCode::label, node, doneLabel, conditions);
 
    node->setRegister(resultReg);
    srm->stopUsingRegisters();
    cg->decReferenceCount(arrayNode);
-   cg->recursivelyDecReferenceCount(node->getSecondChild());
+   if (offsetReg)
+      {
+      cg->decReferenceCount(offsetNode);
+      }
+   else
+      {
+      cg->recursivelyDecReferenceCount(offsetNode);
+      }
    cg->decReferenceCount(lengthNode);
+   if (initialValueReg)
+      {
+      cg->decReferenceCount(initialValueNode);
+      }
+   else if (initialValueNode != NULL)
+      {
+      cg->recursivelyDecReferenceCount(initialValueNode);
+      }
+
+   return resultReg;
+   }
+
+/**
+ * @brief Generates vectorized instruction sequence for computing hashcode of a String
+ *
+ * @param[in] node: node
+ * @param[in] isCompressed: true if compressed string
+ * @param[in] cg: CodeGenerator
+ *
+ * @returns register
+ */
+static TR::Register *inlineStringHashCode(TR::Node *node, bool isCompressed, TR::CodeGenerator *cg)
+   {
+   return hashCodeHelper(node, isCompressed ? TR::Int8 : TR::Int16, false, NULL, cg);
+   }
+
+/**
+ * @brief Generates inlined instructions equivalent to jdk/internal/util/ArraysSupport.vectorizedHashCode
+ *
+ * @param[in] node: node
+ * @param[in] cg: CodeGenerator
+ *
+ * @returns register, or NULL if the element type is not supported
+ */
+static TR::Register *inlineVectorizedHashCode(TR::Node *node, TR::CodeGenerator *cg)
+   {
+   TR::Node *elementTypeNode = node->getChild(4);
+   TR::Register *resultReg = NULL;
+
+   if (!elementTypeNode->getOpCode().isLoadConst())
+      {
+      return NULL;
+      }
+
+   switch (elementTypeNode->getInt())
+      {
+      // The following constants come from the values for the
+      // type operand of the NEWARRAY instruction
+      case 4: // T_BOOLEAN
+         resultReg = hashCodeHelper(node, TR::Int8, false, node->getChild(3), cg);
+         break;
+      case 8: // T_BYTE
+         resultReg = hashCodeHelper(node, TR::Int8, true, node->getChild(3), cg);
+         break;
+      case 5: // T_CHAR
+         resultReg = hashCodeHelper(node, TR::Int16, false, node->getChild(3), cg);
+         break;
+      case 9: // T_SHORT
+         resultReg = hashCodeHelper(node, TR::Int16, true, node->getChild(3), cg);
+         break;
+      case 10: // T_INT
+         resultReg = hashCodeHelper(node, TR::Int32, true, node->getChild(3), cg);
+         break;
+      default:
+         return NULL;
+      }
 
+   cg->decReferenceCount(elementTypeNode);
    return resultReg;
    }
 
@@ -7465,6 +7649,17 @@ J9::ARM64::CodeGenerator::inlineDirectCall(TR::Node *node, TR::Register *&result
             break;
             }
 
+         case TR::jdk_internal_util_ArraysSupport_vectorizedHashCode:
+            if (cg->getSupportsInlineVectorizedHashCode())
+               {
+               resultReg = inlineVectorizedHashCode(node, cg);
+               if (resultReg != NULL)
+                  {
+                  return true;
+                  }
+               }
+            break;
+
          case TR::java_lang_StringCoding_hasNegatives:
             if (cg->getSupportsInlineStringCodingHasNegatives())
                {
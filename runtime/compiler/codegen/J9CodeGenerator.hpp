@@ -419,6 +419,12 @@ public:
     */
    bool supportsInliningOfIsAssignableFrom() { return false; } // no virt, default
 
+   /** \brief
+    *     Determines whether a JNI call to the given java/util/zip/CRC32 or java/util/zip/Adler32 native can be
+    *     dispatched directly to an optimized kernel in the JIT library, without a JNI frame or releasing VM access
+    */
+   bool supportsDirectChecksumKernelCall(TR::RecognizedMethod method) { return false; } // no virt, default
+
    /** \brief
     *     Determines whether the code generator must generate the switch to interpreter snippet in the preprologue.
     */
@@ -385,6 +385,9 @@
    java_util_zip_CRC32_updateByteBuffer0,
    java_util_zip_CRC32C_updateBytes,
    java_util_zip_CRC32C_updateDirectByteBuffer,
+   java_util_zip_Adler32_update,
+   java_util_zip_Adler32_updateBytes,
+   java_util_zip_Adler32_updateByteBuffer,
    sun_misc_Unsafe_compareAndSwapInt_jlObjectJII_Z,
    sun_misc_Unsafe_compareAndSwapLong_jlObjectJJJ_Z,
    sun_misc_Unsafe_compareAndSwapObject_jlObjectJjlObjectjlObject_Z,
@@ -26,6 +26,7 @@
 #pragma once
 
 #include "AtomicSupport.hpp"
+#include "codegen/CodeGenPhase.hpp"
 #include "compile/CompilationTypes.hpp"
 #include "control/CompilationPriority.hpp"
 #include "control/ClassHolder.hpp"
@@ -37,6 +38,7 @@
 #include "env/jittypes.h"
 #include "infra/Flags.hpp"
 #include "infra/Statistics.hpp"
+#include "optimizer/Optimizations.hpp"
 #include "control/rossa.h"
 #include "runtime/RelocationRuntime.hpp"
 #if defined(J9VM_OPT_JITSERVER)
@@ -901,6 +903,21 @@ public:
    bool    dynamicThreadPriority();
 
    void    updateCompilationErrorStats(TR_CompilationErrorCode errorCode) { statCompErrors.update(errorCode); }
+
+   // Passes whose compile time and scratch memory are accounted for separately:
+   // IL generation, followed by every optimization and then every codegen phase
+   // up to and including the last phase of the target platform
+   static const int32_t ilGenProfiledPass = 0;
+#if defined(TR_TARGET_S390)
+   static const int32_t numProfiledCompilationPasses = 1 + OMR::numOpts + TR::CodeGenPhase::LastJ9ZPhase + 1;
+#else
+   static const int32_t numProfiledCompilationPasses = 1 + OMR::numOpts + TR::CodeGenPhase::LastJ9Phase + 1;
+#endif /* defined(TR_TARGET_S390) */
+   static int32_t getProfiledPass(OMR::Optimizations opt) { return 1 + static_cast<int32_t>(opt); }
+   static int32_t getProfiledPass(TR::CodeGenPhase::PhaseValue phase) { return 1 + OMR::numOpts + static_cast<int32_t>(phase); }
+   static const char *getProfiledPassName(int32_t pass);
+   void    updateCompilationPassStats(TR_Hotness level, int32_t pass, uint64_t timeUs, uint64_t scratchBytes);
+   void    printCompilationPassStats();
    bool    SmoothCompilation(TR_MethodToBeCompiled *entry, int32_t *optLevelAdjustment);
    bool    compBudgetSupport() const {return _compBudgetSupport;}
    void    setCompBudgetSupport(bool val) {_compBudgetSupport = val;}
@@ -1313,6 +1330,12 @@ private:
    uint32_t               _statNumJProfilingBodies;
    uint32_t               _statNumRecompilationForBodiesWithJProfiling;
    uint32_t               _statNumMethodsFromJProfilingQueue;
+   uint32_t               _statNumSplitWarmColdBodies; // bodies with a separate cold code section
+   uint64_t               _statTotalSplitWarmCodeBytes;
+   uint64_t               _statTotalSplitColdCodeBytes;
+   // updated without synchronization, like the other statistics
+   uint64_t               _statPassTimeUs[numHotnessLevels][numProfiledCompilationPasses];
+   uint64_t               _statPassScratchBytes[numHotnessLevels][numProfiledCompilationPasses];
    uint32_t               _statTotalAotQueryTime;
    uint32_t               _statTotalAotRelocationTime;
 
@@ -80,6 +80,7 @@
 #include "infra/MonitorTable.hpp"
 #include "infra/Monitor.hpp"
 #include "infra/String.hpp"
+#include "optimizer/Optimizer.hpp"
 #include "ras/InternalFunctions.hpp"
 #include "ras/Logger.hpp"
 #include "runtime/asmprotos.h"
@@ -1084,6 +1085,10 @@ TR::CompilationInfoPerThreadBase::CompilationInfoPerThreadBase(TR::CompilationIn
    _timeWhenCompStarted(),
    _numJITCompilations(),
    _qszWhenCompStarted(),
+   _profiledPass(-1),
+   _profiledPassStartTime(0),
+   _profiledPassStartBytes(0),
+   _profiledScratchSegmentProvider(NULL),
    _compilationCanBeInterrupted(false),
    _uninterruptableOperationDepth(0),
    _compilationThreadState(COMPTHREAD_UNINITIALIZED),
@@ -3464,6 +3469,15 @@ void TR::CompilationInfo::stopCompilationThreads()
       fprintf(stderr, "Time spent relocating all AOT methods: %u ms\n", this->getAotRelocationTime()/1000);
       }
 
+   if (_statNumSplitWarmColdBodies != 0 && TR::Options::getVerboseOption(TR_VerbosePerformance))
+      {
+      TR_VerboseLog::writeLineLocked(TR_Vlog_PERF, "Bodies split into warm and cold code=%u warm=%" OMR_PRIu64 "KB cold=%" OMR_PRIu64 "KB",
+         _statNumSplitWarmColdBodies, _statTotalSplitWarmCodeBytes / 1024, _statTotalSplitColdCodeBytes / 1024);
+      }
+
+   if (TR::Options::getVerboseOption(TR_VerbosePerformance))
+      printCompilationPassStats();
+
    static char * printCompMem = feGetEnv("TR_PrintCompMem");
    static char * printCCUsage = feGetEnv("TR_PrintCodeCacheUsage");
 
@@ -9119,6 +9133,21 @@ TR::CompilationInfoPerThreadBase::wrappedCompile(J9PortLibrary *portLib, void *
                   options->setInsertGCRTrees(); // This is a recommendation not a directive
                   }
 
+               // Hot and scorching bodies are compiled with profiled block frequencies,
+               // which are reliable enough to move their cold blocks out of line.
+               // JITServer does not support a separate cold code section: the client
+               // expects a null coldPC for every body received from the server.
+               if (options->getOptLevel() >= hot &&
+                   TR::Compiler->target.cpu.isX86() &&
+                   !vm->isAOT_DEPRECATED_DO_NOT_USE() &&
+                   !that->_methodBeingCompiled->isRemoteCompReq() &&
+                   !that->_methodBeingCompiled->isOutOfProcessCompReq())
+                  {
+                  static char *splitProfiledBodies = feGetEnv("TR_SplitWarmAndColdBlocksInHotBodies");
+                  if (splitProfiledBodies)
+                     options->setOption(TR_SplitWarmAndColdBlocks);
+                  }
+
                // If the JVM is starved of CPU, do less inlining.
                // This is also what we do for -Xtune:virtualized.
                if (that->_compInfo.isJVMStarved())
@@ -10056,6 +10085,27 @@ TR::CompilationInfoPerThreadBase::compile(
             compiler->getOption(TR_UseSymbolValidationManager))
             compiler->getSymbolValidationManager()->populateWellKnownClasses();
 
+         // Closes the running pass and stops the pass accounting when compile()
+         // returns or throws, so the provider is never used after this scope
+         class ProfiledCompilationPasses
+            {
+         public:
+            ProfiledCompilationPasses(TR::CompilationInfoPerThreadBase &compInfoPT, TR::SegmentAllocator const &scratchSegmentProvider) :
+               _compInfoPT(compInfoPT)
+               {
+               _compInfoPT._profiledPass = -1;
+               _compInfoPT._profiledScratchSegmentProvider = &scratchSegmentProvider;
+               }
+            ~ProfiledCompilationPasses()
+               {
+               _compInfoPT.switchProfiledCompilationPass(-1);
+               _compInfoPT._profiledScratchSegmentProvider = NULL;
+               }
+         private:
+            TR::CompilationInfoPerThreadBase &_compInfoPT;
+            };
+
+         ProfiledCompilationPasses profiledPasses(*this, scratchSegmentProvider);
          rtn = compiler->compile();
 
          if (TR::Options::getVerboseOption(TR_VerboseCompilationDispatch) && !rtn)
@@ -10266,7 +10316,14 @@ TR::CompilationInfoPerThreadBase::compile(
 
       logCompilationSuccess(vmThread, vm, method, scratchSegmentProvider, compilee, compiler, metaData, optimizationPlan);
 
-      TRIGGER_J9HOOK_JIT_COMPILING_END(_jitConfig->hookInterface, vmThread, method);
+      UDATA codeSize = 0;
+      if (metaData)
+         {
+         codeSize = metaData->endWarmPC - metaData->startPC;
+         if (metaData->startColdPC)
+            codeSize += metaData->endPC - metaData->startColdPC;
+         }
+      TRIGGER_J9HOOK_JIT_COMPILING_END(_jitConfig->hookInterface, vmThread, method, TRUE, compiler->getMethodHotness(), _methodBeingCompiled->isDLTCompile(), codeSize);
       }
    catch (const std::exception &e)
       {
@@ -10963,6 +11020,87 @@ TR::CompilationInfoPerThreadBase::methodCanBeCompiled(TR_Memory *trMemory, TR_Fr
    return TR::Options::getDebug()->methodCanBeCompiled(trMemory, method, filter);
    }
 
+void
+TR::CompilationInfoPerThreadBase::switchProfiledCompilationPass(int32_t pass)
+   {
+   if (!_profiledScratchSegmentProvider || !_compiler)
+      return;
+
+   PORT_ACCESS_FROM_JITCONFIG(_jitConfig);
+   uint64_t crtTime = j9time_hires_clock();
+   size_t crtBytes = _profiledScratchSegmentProvider->systemBytesAllocated();
+
+   if (_profiledPass >= 0)
+      {
+      // Scratch memory is charged to the pass that made the compilation acquire it;
+      // segments released to the provider and reused by a later pass are not counted again
+      uint64_t timeUs = j9time_hires_delta(_profiledPassStartTime, crtTime, J9PORT_TIME_DELTA_IN_MICROSECONDS);
+      uint64_t scratchBytes = crtBytes > _profiledPassStartBytes ? crtBytes - _profiledPassStartBytes : 0;
+      _compInfo.updateCompilationPassStats(_compiler->getMethodHotness(), _profiledPass, timeUs, scratchBytes);
+      }
+
+   _profiledPass = pass;
+   _profiledPassStartTime = crtTime;
+   _profiledPassStartBytes = crtBytes;
+   }
+
+const char *
+TR::CompilationInfo::getProfiledPassName(int32_t pass)
+   {
+   if (pass == ilGenProfiledPass)
+      return "ILGeneration";
+   if (pass < getProfiledPass(OMR::numOpts))
+      return TR::Optimizer::getOptimizationName(static_cast<OMR::Optimizations>(pass - 1));
+   return TR::CodeGenPhase::getName(static_cast<TR::CodeGenPhase::PhaseValue>(pass - 1 - OMR::numOpts));
+   }
+
+void
+TR::CompilationInfo::updateCompilationPassStats(TR_Hotness level, int32_t pass, uint64_t timeUs, uint64_t scratchBytes)
+   {
+   if (level >= numHotnessLevels || pass < 0 || pass >= numProfiledCompilationPasses)
+      return;
+   _statPassTimeUs[level][pass] += timeUs;
+   _statPassScratchBytes[level][pass] += scratchBytes;
+   }
+
+void
+TR::CompilationInfo::printCompilationPassStats()
+   {
+   // Only passes that took at least 1 ms in total are listed, most expensive first within each opt level
+   static const uint64_t minReportedTimeUs = 1000;
+   for (int32_t level = 0; level < numHotnessLevels; level++)
+      {
+      uint64_t levelTimeUs = 0;
+      for (int32_t pass = 0; pass < numProfiledCompilationPasses; pass++)
+         levelTimeUs += _statPassTimeUs[level][pass];
+      if (levelTimeUs < minReportedTimeUs)
+         continue;
+
+      TR_VerboseLog::writeLineLocked(TR_Vlog_PERF, "Compilation time per pass at %s: total=%" OMR_PRIu64 "ms",
+         TR::Compilation::getHotnessName(static_cast<TR_Hotness>(level)), levelTimeUs / 1000);
+
+      bool reported[numProfiledCompilationPasses] = {};
+      while (true)
+         {
+         int32_t maxPass = -1;
+         for (int32_t pass = 0; pass < numProfiledCompilationPasses; pass++)
+            {
+            if (!reported[pass] && _statPassTimeUs[level][pass] >= minReportedTimeUs &&
+                (maxPass < 0 || _statPassTimeUs[level][pass] > _statPassTimeUs[level][maxPass]))
+               maxPass = pass;
+            }
+         if (maxPass < 0)
+            break;
+         reported[maxPass] = true;
+         TR_VerboseLog::writeLineLocked(TR_Vlog_PERF, "   %-40s time=%" OMR_PRIu64 "ms (%5.2f%%) scratchMem=%" OMR_PRIu64 "KB",
+            getProfiledPassName(maxPass),
+            _statPassTimeUs[level][maxPass] / 1000,
+            _statPassTimeUs[level][maxPass] * 100.0 / levelTimeUs,
+            _statPassScratchBytes[level][maxPass] / 1024);
+         }
+      }
+   }
+
 void TR::CompilationInfoPerThreadBase::logCompilationSuccess(
    J9VMThread * vmThread,
    TR_J9VMBase &vm,
@@ -11084,6 +11222,14 @@ void TR::CompilationInfoPerThreadBase::logCompilationSuccess(
             endPC = metaData->endPC;
             }
 
+         // Statistics about bodies whose cold blocks were placed in the cold code section
+         if (startColdPC)
+            {
+            _compInfo._statNumSplitWarmColdBodies++;
+            _compInfo._statTotalSplitWarmCodeBytes += endWarmPC - startPC;
+            _compInfo._statTotalSplitColdCodeBytes += endPC - startColdPC;
+            }
+
          TR_Hotness h = compiler->getMethodHotness();
          if (h < numHotnessLevels)
             {
@@ -11697,7 +11843,7 @@ TR::CompilationInfoPerThreadBase::processException(
 
    TR::IlGeneratorMethodDetails & details = _methodBeingCompiled->getMethodDetails();
    J9Method *method = details.getMethod();
-   TRIGGER_J9HOOK_JIT_COMPILING_END(_jitConfig->hookInterface, vmThread, method);
+   TRIGGER_J9HOOK_JIT_COMPILING_END(_jitConfig->hookInterface, vmThread, method, FALSE, compiler->getMethodHotness(), _methodBeingCompiled->isDLTCompile(), 0);
    }
 
 void
@@ -216,6 +216,17 @@ class CompilationInfoPerThreadBase
    static TR_MethodMetaData *wrappedCompile(J9PortLibrary *portLib, void * opaqueParameters);
 
    bool methodCanBeCompiled(TR_Memory *trMemory, TR_FrontEnd *fe, TR_ResolvedMethod *compilee, TR_FilterBST *&filter);
+
+   /**
+    * \brief
+    *    Charge the time and scratch memory used since the previous call to the pass that
+    *    was running on this thread, and start accounting for the given pass.
+    *
+    * \param pass
+    *    The pass that is starting (see TR::CompilationInfo::getProfiledPass), or -1 to only
+    *    close the running pass at the end of the compilation.
+    */
+   void switchProfiledCompilationPass(int32_t pass);
    int32_t                getCompThreadId() const { return _compThreadId; }
 
    /**
@@ -401,6 +412,10 @@ class CompilationInfoPerThreadBase
    uintptr_t                    _timeWhenCompStarted;
    int32_t                      _numJITCompilations; // num JIT compilations this thread has performed; AOT loads not counted
    int32_t                      _qszWhenCompStarted; // size of compilation queue and compilation starts
+   int32_t                      _profiledPass; // pass being timed by switchProfiledCompilationPass; -1 if none
+   uint64_t                     _profiledPassStartTime; // high resolution clock ticks
+   size_t                       _profiledPassStartBytes;
+   TR::SegmentAllocator const * _profiledScratchSegmentProvider;
 
    /// Determines whether this compilation thread can be interrupted the compile at the next yield point. A different
    /// thread may still request that the compilation _should_ be interrupted, however we may not be in a state at
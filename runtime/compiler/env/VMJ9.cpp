@@ -5667,6 +5667,9 @@ TR_J9VMBase::reportILGeneratorPhase()
    enum { DEFAULT_LOW_BYTE=0x80 };
 
    vmThread()->omrVMThread->vmState = J9VMSTATE_JIT | (DEFAULT_LOW_BYTE & 0xFF);
+
+   if (_compInfoPT)
+      _compInfoPT->switchProfiledCompilationPass(TR::CompilationInfo::ilGenProfiledPass);
    }
 
 void
@@ -5676,6 +5679,9 @@ TR_J9VMBase::reportOptimizationPhase(OMR::Optimizations opts)
       return;
 
    vmThread()->omrVMThread->vmState = J9VMSTATE_JIT_OPTIMIZER | ((static_cast<int32_t>(opts) & 0xFF) << 8);
+
+   if (_compInfoPT)
+      _compInfoPT->switchProfiledCompilationPass(TR::CompilationInfo::getProfiledPass(opts));
    }
 
 void
@@ -5706,6 +5712,9 @@ TR_J9VMBase::reportCodeGeneratorPhase(TR::CodeGenPhase::PhaseValue phase)
 
    vmThread()->omrVMThread->vmState = J9VMSTATE_JIT_CODEGEN | phase;
 
+   if (_compInfoPT)
+      _compInfoPT->switchProfiledCompilationPass(TR::CompilationInfo::getProfiledPass(phase));
+
    if (TrcEnabled_Trc_JIT_codeGeneratorPhase)
       Trc_JIT_codeGeneratorPhase(vmThread(), TR::CodeGenPhase::getName(phase));
    }
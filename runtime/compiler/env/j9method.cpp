@@ -3459,6 +3459,14 @@ void TR_ResolvedJ9Method::construct()
       {  TR::unknownMethod}
       };
 
+   static X Adler32Methods[] =
+      {
+      {x(TR::java_util_zip_Adler32_update,              "update",               "(II)I")},
+      {x(TR::java_util_zip_Adler32_updateBytes,         "updateBytes",          "(I[BII)I")},
+      {x(TR::java_util_zip_Adler32_updateByteBuffer,    "updateByteBuffer",     "(IJII)I")},
+      {  TR::unknownMethod}
+      };
+
    static X ByteMethods[] =
       {
       {x(TR::java_lang_Byte_byteValue, "byteValue", "()B")},
@@ -4231,6 +4239,7 @@ void TR_ResolvedJ9Method::construct()
       {
       { "java/lang/ClassLoader", ClassLoaderMethods },
       { "java/lang/StringUTF16", StringUTF16Methods },
+      { "java/util/zip/Adler32", Adler32Methods   },
       { 0 }
       };
 
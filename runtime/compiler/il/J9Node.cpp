@@ -392,6 +392,31 @@ J9::Node::processJNICall(TR::TreeTop *callNodeTreeTop, TR::ResolvedMethodSymbol
       }
 #endif
 
+#if defined(TR_TARGET_X86) && defined(TR_TARGET_64BIT)
+   // Recognizing these methods on x86-64 allows the JNI dispatch to call the CRC32 and
+   // Adler32 kernels in the JIT library directly.  The arguments are not wrapped, so the
+   // array header size is folded into the offset of the byte array variants here.
+   if (comp->cg()->supportsDirectChecksumKernelCall(methodSymbol->getRecognizedMethod()))
+      {
+#if JAVA_SPEC_VERSION <= 8
+      if ((methodSymbol->getRecognizedMethod() == TR::java_util_zip_CRC32_updateBytes) ||
+#else
+      if ((methodSymbol->getRecognizedMethod() == TR::java_util_zip_CRC32_updateBytes0) ||
+#endif
+          (methodSymbol->getRecognizedMethod() == TR::java_util_zip_Adler32_updateBytes))
+         {
+         TR::Node *offset = self()->getChild(2);
+         TR::Node *dataOffset = TR::Node::create(TR::iadd, 2, offset,
+            TR::Node::iconst(offset, TR::Compiler->om.contiguousArrayHeaderSizeInBytes()));
+         offset->decReferenceCount();
+         self()->setAndIncChild(2, dataOffset);
+         }
+
+      self()->setPreparedForDirectJNI();
+      return self();
+      }
+#endif
+
    // In the latest round of VM drops, we've lowered the maximum outgoing argument size on the C stack to 32
    // (it used to be the maximum 255).  This means that fixed frame platforms (those who pre-allocate space
    // in the C stack for outgoing arguments, as opposed to buying new stack to pass arguments) who implement
@@ -119,6 +119,7 @@ J9::CFG::setFrequencies()
       resetFrequencies();
       }
    _max_edge_freq = MAX_PROF_EDGE_FREQ;
+   _hasProfiledFrequencies = false;
 
    TR_ExternalProfiler *profiler;
 
@@ -133,6 +134,7 @@ J9::CFG::setFrequencies()
           )
       )
       {
+      _hasProfiledFrequencies = true;
       if (!self()->consumePseudoRandomFrequencies())
          {
          _externalProfiler = comp()->fej9()->hasIProfilerBlockFrequencyInfo(*comp());
@@ -165,6 +167,7 @@ J9::CFG::setFrequencies()
       }
    else if ((profiler = comp()->fej9()->hasIProfilerBlockFrequencyInfo(*comp())))
       {
+      _hasProfiledFrequencies = true;
       if (!self()->consumePseudoRandomFrequencies())
          {
          profiler->setBlockAndEdgeFrequencies(self(), comp());
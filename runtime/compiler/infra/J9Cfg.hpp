@@ -65,13 +65,15 @@ public:
 
    CFG(TR::Compilation *c, TR::ResolvedMethodSymbol *m) :
          OMR::CFGConnector(c, m),
-      _externalProfiler(NULL)
+      _externalProfiler(NULL),
+      _hasProfiledFrequencies(false)
       {
       }
 
    CFG(TR::Compilation *c, TR::ResolvedMethodSymbol *m, TR::Region &r) :
          OMR::CFGConnector(c, m, r),
-      _externalProfiler(NULL)
+      _externalProfiler(NULL),
+      _hasProfiledFrequencies(false)
       {
       }
 
@@ -93,6 +95,13 @@ public:
    void setBlockFrequency(TR::CFGNode *node, int32_t frequency, bool addFrequency = false);
 
    bool hasBranchProfilingData() { return _externalProfiler ? true : false; }
+
+   /**
+    * Returns true if the block frequencies were last set by setFrequencies()
+    * from JIT profiling or interpreter profiling data rather than estimated
+    * from the structure.
+    */
+   bool hasProfiledFrequencies() { return _hasProfiledFrequencies; }
    void getBranchCountersFromProfilingData(TR::Node *node, TR::Block *block, int32_t *taken, int32_t *notTaken);
 
    bool emitVerbosePseudoRandomFrequencies();
@@ -100,6 +109,7 @@ public:
 protected:
 
    TR_ExternalProfiler *_externalProfiler;
+   bool _hasProfiledFrequencies;
    };
 
 }
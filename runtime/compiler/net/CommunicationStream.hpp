@@ -129,7 +129,7 @@ protected:
    // likely to lose an increment when merging/rebasing/etc.
    //
    static const uint8_t MAJOR_NUMBER = 1;
-   static const uint16_t MINOR_NUMBER = 95; // ID: CG1NgwI3xhSuaFWEztYD
+   static const uint16_t MINOR_NUMBER = 96; // ID: 81XMRFTL3oruvxkVTxkn
    static const uint8_t PATCH_NUMBER = 0;
    static uint32_t CONFIGURATION_FLAGS;
 
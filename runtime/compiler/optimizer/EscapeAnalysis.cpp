@@ -29,6 +29,7 @@
 
 #include <algorithm>
 #include <stdint.h>
+#include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
 #include "codegen/CodeGenerator.hpp"
@@ -1948,7 +1949,8 @@ bool TR_EscapeAnalysis::isEscapePointCold(Candidate *candidate, TR::Node *node)
    if (!disableColdEsc &&
        (_inColdBlock ||
         (candidate->isInsideALoop() &&
-         (candidate->_block->getFrequency() > 4*_curBlock->getFrequency()))) &&
+         (candidate->_block->getFrequency() > 4*_curBlock->getFrequency())) ||
+        isEscapePointRarelyExecuted(candidate)) &&
        (candidate->_origKind == TR::New || candidate->_origKind == TR::newvalue))
       return true;
 
@@ -1956,6 +1958,34 @@ bool TR_EscapeAnalysis::isEscapePointCold(Candidate *candidate, TR::Node *node)
    }
 
 
+// With profiled block frequencies an escape on a rarely taken path (e.g. a
+// logging or error branch) is treated like one in a cold block even when the
+// allocation is not in a loop, so that the object is only heapified on that path.
+// The frequencies may come from JIT profiling or from the interpreter profiler;
+// estimates derived from the structure are not trusted for this.
+//
+bool TR_EscapeAnalysis::isEscapePointRarelyExecuted(Candidate *candidate)
+   {
+   static const char *disableProfiledColdEsc = feGetEnv("TR_DisableProfiledColdEscape");
+   static const char *ratioStr = feGetEnv("TR_ProfiledColdEscapeRatio");
+   static const int32_t ratio = ratioStr ? atoi(ratioStr) : 20;
+
+   // A ratio of zero or less would make every escape point cold
+   if (disableProfiledColdEsc ||
+       ratio <= 0 ||
+       _parms ||
+       !comp()->getFlowGraph()->hasProfiledFrequencies())
+      return false;
+
+   int32_t allocFrequency = candidate->_block->getFrequency();
+   int32_t escapeFrequency = _curBlock->getFrequency();
+   if (allocFrequency <= MAX_COLD_BLOCK_COUNT+1 || escapeFrequency < 0)
+      return false;
+
+   return allocFrequency > ratio*escapeFrequency;
+   }
+
+
 void TR_EscapeAnalysis::checkDefsAndUses()
    {
    OMR::Logger *log = comp()->log();
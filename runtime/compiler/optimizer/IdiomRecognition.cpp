@@ -6499,6 +6499,23 @@ TR_CISCTransformer::removeAllNodes(TR::TreeTop *start, TR::TreeTop *end)
    }
 
 
+//*****************************************************************************
+// Set the positions of all byte values x for which (x & 0xff) < limit.
+// limit is an unsigned value in [0, 256] and the byte x is at position x+bvoffset,
+// so bvoffset must be at least 128 (BYTEBVOFFSET).
+// Unsigned byte compares are produced by narrowing "(b & 0xff) < 0x80" and are
+// the usual delimiter test of UTF-8 decoding loops.
+//*****************************************************************************
+static void
+setUnsignedByteRangeBelow(TR_BitVector &bv, int32_t limit, int32_t bvoffset)
+   {
+   bv.empty();
+   if (limit > 0)
+      bv.setAll(bvoffset, bvoffset + (limit < 128 ? limit : 128) - 1);       // 0 .. 127
+   if (limit > 128)
+      bv.setAll(bvoffset - 128, bvoffset + limit - 256 - 1);               // -128 .. -1
+   }
+
 //*****************************************************************************
 // These functions create function tables for TRT or TRxx instructions.
 //*****************************************************************************
@@ -6685,6 +6702,35 @@ TR_CISCTransformer::analyzeBoolTable(TR_BitVector **bv, TR::TreeTop **retSameExi
                      takenBV &= tmpBV;
                      ntakenBV -= tmpBV;
                      break;
+                  case TR::ifbucmplt:
+                  case TR::ifbucmpge:
+                  case TR::ifbucmpgt:
+                  case TR::ifbucmple:
+                     {
+                     // Only the byte table has positions for negative byte values
+                     if (bvoffset < 128)
+                        {
+                        countUnhandledOpcode(__FUNCTION__, n->getOpcode());
+                        return false;
+                        }
+                     int32_t limit = child1->getOtherInfo() & 0xff;
+                     if (n->getOpcode() == TR::ifbucmpgt || n->getOpcode() == TR::ifbucmple)
+                        limit++;
+                     setUnsignedByteRangeBelow(tmpBV, limit, bvoffset);
+                     takenBV = *bv[tID];
+                     ntakenBV = takenBV;
+                     if (n->getOpcode() == TR::ifbucmplt || n->getOpcode() == TR::ifbucmple)
+                        {
+                        takenBV &= tmpBV;
+                        ntakenBV -= tmpBV;
+                        }
+                     else
+                        {
+                        ntakenBV &= tmpBV;
+                        takenBV -= tmpBV;
+                        }
+                     break;
+                     }
                   default:
                      // not implemented yet
                      countUnhandledOpcode(__FUNCTION__, n->getOpcode());
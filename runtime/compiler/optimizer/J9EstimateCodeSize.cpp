@@ -62,6 +62,10 @@ const float TR_J9EstimateCodeSize::CONST_ARG_IN_CALLEE_ADJUSTMENT_FACTOR = 0.75f
 
 #define DEFAULT_GRACE_INLINING_THRESHOLD 100
 
+#define DEFAULT_HOT_PATH_FREE_DEPTH 3
+
+#define MAX_HOT_PATH_CUTOFF_SHIFT 7
+
 #define DEFAULT_ANALYZED_ALLOWANCE_FACTOR 2
 
 #define DEFAULT_FORCEINLINE_MULTIPLIER 5
@@ -374,6 +378,26 @@ TR_J9EstimateCodeSize::isInExceptionRange(TR_ResolvedMethod * feMethod,
    }
 
 
+// Block frequencies seen by ECS are relative to the 10000 given to the root
+// target, so they tell how much of the compiled method's execution a call
+// chain accounts for. With TR_EnableHotPathInlining the cold call cutoff
+// doubles for every level below the free depth: cold chains are abandoned
+// early while chains that keep most of the root frequency can still be
+// explored down to the maximum recursion depth.
+static int32_t hotPathFrequencyCutoff(int32_t depth, int32_t freqCutoff)
+   {
+   static const char *fd = feGetEnv("TR_HotPathInliningFreeDepth");
+   static const int32_t freeDepth = fd ? atoi(fd) : DEFAULT_HOT_PATH_FREE_DEPTH;
+
+   if (depth <= freeDepth)
+      return freqCutoff;
+
+   int32_t shift = depth - freeDepth;
+   if (shift > MAX_HOT_PATH_CUTOFF_SHIFT)
+      shift = MAX_HOT_PATH_CUTOFF_SHIFT;
+   return freqCutoff << shift;
+   }
+
 static bool cameFromArchetypeSpecimen(TR_ResolvedMethod *method)
    {
    if (!method)
@@ -1785,8 +1809,18 @@ TR_J9EstimateCodeSize::realEstimateCodeSize(TR_CallTarget *calltarget, TR_CallSt
 
                   static const char *fc = feGetEnv("TR_FrequencyCutoff");
                   static const int32_t freqCutoff = fc ? atoi(fc) : DEFAULT_FREQ_CUTOFF;
+                  static const bool enableHotPathInlining = feGetEnv("TR_EnableHotPathInlining") != NULL;
+
+                  int32_t callFreqCutoff = freqCutoff;
+                  if (enableHotPathInlining && comp()->getMethodHotness() >= warm)
+                     {
+                     callFreqCutoff = hotPathFrequencyCutoff(_recursionDepth, freqCutoff);
+                     if (callFreqCutoff != freqCutoff)
+                        heuristicTrace(tracer(),"Depth %d: hot path cutoff for call %s is %d, block frequency %d.",
+                           _recursionDepth, calleeName, callFreqCutoff, currentBlock->getFrequency());
+                     }
 
-                  bool isColdCall = (currentBlock->getFrequency() < freqCutoff || isInterpretedCallWithLowFrequency)
+                  bool isColdCall = (currentBlock->getFrequency() < callFreqCutoff || isInterpretedCallWithLowFrequency)
                                     && !(_inliner->alwaysWorthInlining(targetCallee->_calleeMethod, NULL));
 
                   if (coldCallInfoIsReliable && isColdCall)
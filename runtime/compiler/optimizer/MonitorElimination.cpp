@@ -2632,7 +2632,19 @@ void TR::MonitorElimination::coarsenMonitorRanges()
          {
            //dumpOptDetails(comp(), "Contains calls set for block_%d because of node %p\n", blockNum, treetopNode);
          _containsCalls->set(blockNum);
-         containsCall = true;
+
+         // A volatile access that can neither call out nor throw may be moved into
+         // a synchronized region, so it does not stop the monexit before it from
+         // being coarsened with a following monent on the same object in this block.
+         // This is the common shape after inlining consecutive synchronized accessors.
+         static const bool disableLocalCoarseningOverVolatiles = feGetEnv("TR_DisableLocalCoarseningOverVolatiles") != NULL;
+         if (exceptionInThisTree ||
+             node->getOpCode().isCall() ||
+             (treetopNode->getOpCodeValue() == TR::asynccheck) ||
+             disableLocalCoarseningOverVolatiles)
+            containsCall = true;
+         else
+            logprintf(trace(), log, "Volatile access %p does not prevent local coarsening in block_%d\n", node, blockNum);
 
          /*
          if (_monentBlockInfo[blockNum] == -2)
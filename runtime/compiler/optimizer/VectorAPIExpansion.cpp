@@ -2805,6 +2805,261 @@ TR::Node *TR_VectorAPIExpansion::transformStoreToArray(TR_VectorAPIExpansion *op
    }
 
 
+TR::Node *TR_VectorAPIExpansion::extractIntrinsicHandler(TR_VectorAPIExpansion *opt, TR::TreeTop *treeTop, TR::Node *node,
+                                                         TR::DataType elementType, TR::VectorLength vectorLength, vapiObjType objectType,
+                                                         int32_t numLanes, handlerMode mode)
+   {
+   TR::Compilation *comp = opt->comp();
+
+   // scalar result cannot be represented as a scalarized node
+   if (mode == checkScalarization)
+      return NULL;
+
+   TR::DataType vectorType = TR::DataType::createVectorType(elementType, vectorLength);
+   TR::ILOpCodes vectorOpCode = TR::ILOpCode::createVectorOpCode(TR::vgetelem, vectorType);
+
+   if (mode == checkVectorization)
+      {
+      // VectorMask.laneIsSet() uses extract() too
+      if (opt->getObjectTypeFromClassNode(comp, node->getFirstChild()) != Vector)
+         return NULL;
+
+      if (!isOpCodeImplemented(comp, vectorOpCode))
+         return NULL;
+
+      return node;
+      }
+
+   logprintf(opt->_trace, comp->log(), "extractIntrinsicHandler for node %p\n", node);
+
+   TR::Node *vectorNode = node->getChild(3);
+   TR::Node *indexNode = node->getChild(4);
+
+   if (vectorNode->getOpCodeValue() == TR::aload || vectorNode->getOpCodeValue() == TR::acall)
+      vectorizeLoadOrStore(opt, vectorNode, vectorType);
+
+   anchorOldChildren(opt, treeTop, node);
+
+   TR::Node *getElemNode = node;
+
+   if (elementType != TR::Int64)
+      {
+      // extract intrinsic returns Long but vgetelem has vector element type
+      TR::ILOpCodes convOpCode = TR::BadILOp;
+
+      switch (elementType)
+         {
+         case TR::Int8:
+         case TR::Int16:
+         case TR::Int32:
+            convOpCode = TR::ILOpCode::getDataTypeConversion(elementType, TR::Int64);
+            break;
+         case TR::Float:
+            convOpCode = TR::i2l;  // will have fbits2i as a child
+            break;
+         case TR::Double:
+            convOpCode = TR::ILOpCode::getDataTypeBitConversion(TR::Double, TR::Int64);
+            break;
+         default:
+            TR_ASSERT_FATAL(false, "Wrong vector element type for extract operation\n");
+         }
+
+      TR::Node::recreate(node, convOpCode);
+
+      getElemNode = TR::Node::create(node, vectorOpCode, 2);
+      TR::Node *childNode = getElemNode;
+
+      if (elementType == TR::Float)
+         {
+         childNode = TR::Node::create(node, TR::ILOpCode::getDataTypeBitConversion(TR::Float, TR::Int32), 1);
+         childNode->setAndIncChild(0, getElemNode);
+         }
+
+      node->setAndIncChild(0, childNode);
+      node->setNumChildren(1);
+      }
+   else
+      {
+      TR::Node::recreate(node, vectorOpCode);
+      }
+
+   getElemNode->setAndIncChild(0, vectorNode);
+   getElemNode->setAndIncChild(1, indexNode);
+   getElemNode->setNumChildren(2);
+
+   if (TR::Options::getVerboseOption(TR_VerboseVectorAPI))
+      {
+      TR::ILOpCode opcode(vectorOpCode);
+      TR_VerboseLog::writeLine(TR_Vlog_VECTOR_API, "Vectorized using %s%s in %s at %s %s",
+                               opcode.getName(), TR::DataType::getName(opcode.getVectorResultDataType()),
+                               comp->signature(), comp->getHotnessName(comp->getMethodHotness()), comp->isDLT() ? "DLT" : "");
+      }
+   comp->setVectorApiTransformationPerformed(true);
+
+   return node;
+   }
+
+
+TR::Node *TR_VectorAPIExpansion::insertIntrinsicHandler(TR_VectorAPIExpansion *opt, TR::TreeTop *treeTop, TR::Node *node,
+                                                        TR::DataType elementType, TR::VectorLength vectorLength, vapiObjType objectType,
+                                                        int32_t numLanes, handlerMode mode)
+   {
+   TR::Compilation *comp = opt->comp();
+
+   if (mode == checkScalarization)
+      return NULL;
+
+   TR::DataType vectorType = TR::DataType::createVectorType(elementType, vectorLength);
+   TR::ILOpCodes vectorOpCode = TR::ILOpCode::createVectorOpCode(TR::vsetelem, vectorType);
+
+   if (mode == checkVectorization)
+      {
+      if (objectType != Vector)
+         return NULL;
+
+      if (!isOpCodeImplemented(comp, vectorOpCode))
+         return NULL;
+
+      return node;
+      }
+
+   logprintf(opt->_trace, comp->log(), "insertIntrinsicHandler for node %p\n", node);
+
+   TR::Node *vectorNode = node->getChild(3);
+   TR::Node *indexNode = node->getChild(4);
+   TR::Node *valueNode = node->getChild(5);
+
+   if (vectorNode->getOpCodeValue() == TR::aload || vectorNode->getOpCodeValue() == TR::acall)
+      vectorizeLoadOrStore(opt, vectorNode, vectorType);
+
+   anchorOldChildren(opt, treeTop, node);
+
+   // insert intrinsic passes the new value as Long but vsetelem expects vector element type
+   switch (elementType)
+      {
+      case TR::Int8:
+      case TR::Int16:
+      case TR::Int32:
+         valueNode = TR::Node::create(node, TR::ILOpCode::getDataTypeConversion(TR::Int64, elementType), 1, valueNode);
+         break;
+      case TR::Int64:
+         break;
+      case TR::Float:
+         valueNode = TR::Node::create(node, TR::l2i, 1, valueNode);
+         valueNode = TR::Node::create(node, TR::ILOpCode::getDataTypeBitConversion(TR::Int32, TR::Float), 1, valueNode);
+         break;
+      case TR::Double:
+         valueNode = TR::Node::create(node, TR::ILOpCode::getDataTypeBitConversion(TR::Int64, TR::Double), 1, valueNode);
+         break;
+      default:
+         TR_ASSERT_FATAL(false, "Wrong vector element type for insert operation\n");
+      }
+
+   TR::Node::recreate(node, vectorOpCode);
+   node->setAndIncChild(0, vectorNode);
+   node->setAndIncChild(1, indexNode);
+   node->setAndIncChild(2, valueNode);
+   node->setNumChildren(3);
+
+   if (TR::Options::getVerboseOption(TR_VerboseVectorAPI))
+      {
+      TR::ILOpCode opcode(vectorOpCode);
+      TR_VerboseLog::writeLine(TR_Vlog_VECTOR_API, "Vectorized using %s%s in %s at %s %s",
+                               opcode.getName(), TR::DataType::getName(opcode.getVectorResultDataType()),
+                               comp->signature(), comp->getHotnessName(comp->getMethodHotness()), comp->isDLT() ? "DLT" : "");
+      }
+   comp->setVectorApiTransformationPerformed(true);
+
+   return node;
+   }
+
+
+TR::Node *TR_VectorAPIExpansion::loadMaskedIntrinsicHandler(TR_VectorAPIExpansion *opt, TR::TreeTop *treeTop, TR::Node *node,
+                                                            TR::DataType elementType, TR::VectorLength vectorLength, vapiObjType objectType,
+                                                            int32_t numLanes, handlerMode mode)
+   {
+   TR::Compilation *comp = opt->comp();
+   OMR::Logger *log = comp->log();
+
+#if JAVA_SPEC_VERSION <= 21
+   int32_t maskIndex = 6;
+#else
+   int32_t maskIndex = 7;
+#endif
+   int32_t offsetInRangeIndex = maskIndex + 1;
+
+   if (mode == checkScalarization)
+      return NULL;
+
+   TR::DataType vectorType = TR::DataType::createVectorType(elementType, vectorLength);
+   TR::ILOpCodes loadOpCode = TR::ILOpCode::createVectorOpCode(TR::vloadi, vectorType);
+   TR::ILOpCodes splatsOpCode = TR::ILOpCode::createVectorOpCode(TR::vsplats, vectorType);
+   TR::ILOpCodes blendOpCode = TR::ILOpCode::createVectorOpCode(TR::vblend, vectorType);
+
+   if (mode == checkVectorization)
+      {
+      if (objectType != Vector)
+         return NULL;
+
+      // Loading the whole vector is only safe when the library has already checked
+      // that all the lanes are within the array. Otherwise, unset lanes can be out of bounds
+      TR::Node *offsetInRangeNode = node->getChild(offsetInRangeIndex);
+
+      if (!offsetInRangeNode->getOpCode().isLoadConst() ||
+          offsetInRangeNode->get32bitIntegralValue() != 1)
+         {
+         logprintf(opt->_trace, log, "Masked load in node %p might be out of range\n", node);
+         return NULL;
+         }
+
+      if (!isOpCodeImplemented(comp, loadOpCode) ||
+          !isOpCodeImplemented(comp, splatsOpCode) ||
+          !isOpCodeImplemented(comp, blendOpCode))
+         return NULL;
+
+      return node;
+      }
+
+   logprintf(opt->_trace, log, "loadMaskedIntrinsicHandler for node %p\n", node);
+
+   TR::Node *base = node->getChild(4);
+   TR::Node *offset = node->getChild(5);
+   TR::Node *maskNode = node->getChild(maskIndex);
+
+   if (maskNode->getOpCodeValue() == TR::aload || maskNode->getOpCodeValue() == TR::acall)
+      vectorizeLoadOrStore(opt, maskNode, TR::DataType::createMaskType(elementType, vectorLength));
+
+   TR::Node *aladdNode = generateAddressNode(base, offset);
+
+   anchorOldChildren(opt, treeTop, node);
+
+   TR::SymbolReference *symRef = comp->getSymRefTab()->findOrCreateArrayShadowSymbolRef(vectorType, NULL);
+   TR::Node *loadNode = TR::Node::createWithSymRef(node, loadOpCode, 1, symRef);
+   loadNode->setAndIncChild(0, aladdNode);
+
+   TR::Node *zeroNode = TR::Node::create(node, TR::ILOpCode::constOpCode(elementType), 0, 0);
+   TR::Node *splatsNode = TR::Node::create(node, splatsOpCode, 1, zeroNode);
+
+   // unset lanes are zero
+   TR::Node::recreate(node, blendOpCode);
+   node->setAndIncChild(0, splatsNode);
+   node->setAndIncChild(1, loadNode);
+   node->setAndIncChild(2, maskNode);
+   node->setNumChildren(3);
+
+   if (TR::Options::getVerboseOption(TR_VerboseVectorAPI))
+      {
+      TR::ILOpCode opcode(blendOpCode);
+      TR_VerboseLog::writeLine(TR_Vlog_VECTOR_API, "Vectorized using %s%s in %s at %s %s",
+                               opcode.getName(), TR::DataType::getName(opcode.getVectorResultDataType()),
+                               comp->signature(), comp->getHotnessName(comp->getMethodHotness()), comp->isDLT() ? "DLT" : "");
+      }
+   comp->setVectorApiTransformationPerformed(true);
+
+   return node;
+   }
+
+
 TR::Node *TR_VectorAPIExpansion::unaryIntrinsicHandler(TR_VectorAPIExpansion *opt, TR::TreeTop *treeTop, TR::Node *node,
                                                        TR::DataType elementType, TR::VectorLength vectorLength, vapiObjType objectType,
                                                        int32_t numLanes, handlerMode mode)
@@ -3763,12 +4018,16 @@ TR_VectorAPIExpansion::methodTable[] =
    {compareIntrinsicHandler,              Mask,    1,  2, 3, 4,  5, 2,  7, {Unknown, Unknown, Unknown, ElementType, NumLanes, Vector, Vector, Mask}},   // jdk_internal_vm_vector_VectorSupport_compare
    {compressExpandOpIntrinsicHandler,     Unknown, 1,  2, 3, 4,  5, 2, -1, {Unknown, Unknown, Unknown, ElementType, NumLanes, Vector, Mask}},           // jdk_internal_vm_vector_VectorSupport_compressExpandOp
    {convertIntrinsicHandler,              Unknown,  1,  4, 5, 6,  7, 1, -1, {Unknown, Unknown, ElementType, NumLanes, Unknown, Unknown, Unknown, Vector}},   // jdk_internal_vm_vector_VectorSupport_convert
-   {unsupportedHandler,                   Invalid},  // jdk_internal_vm_vector_VectorSupport_extract
+   {extractIntrinsicHandler,              Scalar,  0, -1, 1, 2,  3, 1, -1, {Unknown, ElementType, NumLanes, Vector, Unknown, Unknown}},                  // jdk_internal_vm_vector_VectorSupport_extract
    {fromBitsCoercedIntrinsicHandler,      Unknown, 0, -1, 1, 2, -1, 0, -1, {Unknown, ElementType, NumLanes, Unknown, Unknown, Unknown}},                // jdk_internal_vm_vector_VectorSupport_fromBitsCoerced
    {unsupportedHandler,                   Invalid},  // jdk_internal_vm_vector_VectorSupport_indexPartiallyInUpperRange
    {unsupportedHandler,                   Invalid},  // jdk_internal_vm_vector_VectorSupport_indexVector
-   {unsupportedHandler,                   Invalid},  // jdk_internal_vm_vector_VectorSupport_insert
-   {unsupportedHandler,                   Invalid},  // jdk_internal_vm_vector_VectorSupport_loadMasked
+   {insertIntrinsicHandler,               Unknown, 0, -1, 1, 2,  3, 1, -1, {Unknown, ElementType, NumLanes, Vector, Unknown, Unknown, Unknown}},         // jdk_internal_vm_vector_VectorSupport_insert
+#if JAVA_SPEC_VERSION <= 21
+   {loadMaskedIntrinsicHandler,           Unknown, 0,  1, 2, 3, -1, 0,  6, {Unknown, Unknown, ElementType, NumLanes, Unknown, Unknown, Mask}},          // jdk_internal_vm_vector_VectorSupport_loadMasked
+#else
+   {loadMaskedIntrinsicHandler,           Unknown, 0,  1, 2, 3, -1, 0,  7, {Unknown, Unknown, ElementType, NumLanes, Unknown, Unknown, Unknown, Mask}}, // jdk_internal_vm_vector_VectorSupport_loadMasked
+#endif
    {unsupportedHandler,                   Invalid},  // jdk_internal_vm_vector_VectorSupport_loadWithMap
    {maskReductionCoercedIntrinsicHandler, Scalar,  1, -1, 2, 3,  4, 1, -1, {Unknown, Unknown, ElementType, NumLanes, Mask}},                            // jdk_internal_vm_vector_VectorSupport_maskReductionCoerced
    {unsupportedHandler,                   Invalid},  // jdk_internal_vm_vector_VectorSupport_rearrangeOp
@@ -102,6 +102,9 @@ namespace  {
          {
          // Clear the flag to allow compilation to continue
          vmThread->javaVM->jitConfig->runtimeFlags &= ~J9JIT_CODE_CACHE_FULL;
+         // Profiling was turned off when the code cache was almost full; allow it again
+         // if the space freed by reclamation brings us back under the threshold
+         TR::CodeCacheManager::instance()->resetLowCodeCacheSpaceThreshold();
          }
       }
 
@@ -786,6 +786,21 @@ J9::CodeCacheManager::almostOutOfCodeCache()
    }
 
 
+void
+J9::CodeCacheManager::resetLowCodeCacheSpaceThreshold()
+   {
+   if (!_lowCodeCacheSpaceThresholdReached)
+      return;
+
+   _lowCodeCacheSpaceThresholdReached = false;
+   _jitConfig->lowCodeCacheFreeSpace = 0;
+   if (self()->codeCacheConfig().verbosePerformance())
+      {
+      TR_VerboseLog::writeLineLocked(TR_Vlog_CODECACHE,"Code cache space was reclaimed. Re-evaluating code cache space threshold.");
+      }
+   }
+
+
 void
 J9::CodeCacheManager::printMccStats()
    {
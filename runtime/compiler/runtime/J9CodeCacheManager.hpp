@@ -140,6 +140,13 @@ public:
     */
    bool almostOutOfCodeCache();
 
+   /**
+    * @brief Forget that the low code cache space threshold was reached so
+    *        that the next almostOutOfCodeCache() query looks at the free
+    *        space again. Called after method bodies have been reclaimed.
+    */
+   void resetLowCodeCacheSpaceThreshold();
+
    /**
     * @brief Print some code cache usage statistics
     */
@@ -776,7 +776,10 @@ J9::X86::AMD64::JNILinkage::generateMethodDispatch(
       _JNIDispatchInfo.dispatchTrampolineRegister,
       _JNIDispatchInfo.callPostDeps,
       cg());
-   cg()->getJNICallSites().push_front(new (trHeapMemory()) TR_Pair<TR_ResolvedMethod, TR::Instruction>(callSymbol->getResolvedMethod(), patchedInstr));
+   // Calls to the checksum kernels must not be repatched if the natives are re-registered
+   //
+   if (!cg()->supportsDirectChecksumKernelCall(callSymbol->getRecognizedMethod()))
+      cg()->getJNICallSites().push_front(new (trHeapMemory()) TR_Pair<TR_ResolvedMethod, TR::Instruction>(callSymbol->getResolvedMethod(), patchedInstr));
 
    if (isJNIGCPoint)
       instr->setNeedsGCMap(_systemLinkage->getProperties().getPreservedRegisterMapForGC());
@@ -1325,6 +1328,24 @@ TR::Register *J9::X86::AMD64::JNILinkage::buildDirectJNIDispatch(TR::Node *callN
          }
       }
 
+   // CRC32 and Adler32 natives recognized by the code generator are dispatched straight to the
+   // kernels in the JIT library.  The call node was left unwrapped by processJNICall and has no
+   // class argument, so the node children are passed as they are.
+   //
+   bool isChecksumKernel = !isGPUHelper && cg()->supportsDirectChecksumKernelCall(callSymbol->getRecognizedMethod());
+   if (isChecksumKernel)
+      {
+      dropVMAccess = false;
+      killNonVolatileGPRs = false;
+      isJNIGCPoint = false;
+      checkExceptions = false;
+      createJNIFrame = false;
+      tearDownJNIFrame = false;
+      wrapRefs = false;
+      passReceiver = true;
+      passThread = false;
+      }
+
    // Anchor the Java frame here to establish the top of the frame.  The reason this must occur here
    // is because the subsequent manual adjustments of the stack pointer confuse the vfp logic.
    // This should be fixed in a subsquent revision of that code.
@@ -1398,6 +1419,25 @@ TR::Register *J9::X86::AMD64::JNILinkage::buildDirectJNIDispatch(TR::Node *callN
       callNode->setSymbolReference(gpuHelperSymRef);
       targetAddress = (uintptr_t)callSymbol->getMethodAddress();
       }
+   else if (isChecksumKernel)
+      {
+      switch (callSymbol->getRecognizedMethod())
+         {
+         case TR::java_util_zip_CRC32_update:
+            targetAddress = (uintptr_t)crc32_oneByte;
+            break;
+         case TR::java_util_zip_Adler32_update:
+            targetAddress = (uintptr_t)adler32_oneByte;
+            break;
+         case TR::java_util_zip_Adler32_updateBytes:
+         case TR::java_util_zip_Adler32_updateByteBuffer:
+            targetAddress = (uintptr_t)adler32_ssse3;
+            break;
+         default:
+            targetAddress = (uintptr_t)crc32_pclmul;
+            break;
+         }
+      }
    else
       {
       TR::ResolvedMethodSymbol *callSymbol1  = callNode->getSymbol()->castToResolvedMethodSymbol();
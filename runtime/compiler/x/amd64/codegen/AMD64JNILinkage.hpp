@@ -36,6 +36,14 @@ namespace TR { class LabelSymbol; }
 namespace TR { class Node; }
 namespace TR { class RegisterDependencyConditions; }
 
+extern "C"
+   {
+   uint32_t crc32_oneByte(uint32_t crc, uint32_t b);
+   uint32_t crc32_pclmul(uint32_t crc, const uint8_t *base, int32_t off, int32_t len);
+   uint32_t adler32_oneByte(uint32_t adler, uint32_t b);
+   uint32_t adler32_ssse3(uint32_t adler, const uint8_t *base, int32_t off, int32_t len);
+   }
+
 #define IMCOMPLETELINKAGE  "This class is only used to generate call-out sequence but no call-in sequence, so it is not used as a complete linkage."
 
 namespace J9
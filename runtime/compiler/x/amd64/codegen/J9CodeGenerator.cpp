@@ -32,6 +32,7 @@
 #include "il/Node.hpp"
 #include "il/Node_inlines.hpp"
 #include "env/CompilerEnv.hpp"
+#include "env/VMJ9.h"
 
 void
 J9::X86::AMD64::CodeGenerator::initialize()
@@ -112,3 +113,46 @@ J9::X86::AMD64::CodeGenerator::createLinkage(TR_LinkageConventions lc)
    self()->setLinkage(lc, linkage);
    return linkage;
    }
+
+
+bool
+J9::X86::AMD64::CodeGenerator::supportsDirectChecksumKernelCall(TR::RecognizedMethod method)
+   {
+   TR::Compilation *comp = self()->comp();
+   static const bool disableCRC32 = feGetEnv("TR_x86DisableCRC32") != NULL;
+   static const bool disableAdler32 = feGetEnv("TR_x86DisableAdler32") != NULL;
+
+   // The kernels are called through their addresses in the JIT library, which are not
+   // relocatable and need not match the client side addresses in JITServer mode.
+   if (comp->compileRelocatableCode() ||
+       comp->requiresSpineChecks() ||
+       TR::Compiler->om.canGenerateArraylets() ||
+       TR::Compiler->om.isOffHeapAllocationEnabled())
+      return false;
+
+#if defined(J9VM_OPT_JITSERVER)
+   if (comp->isOutOfProcessCompilation())
+      return false;
+#endif /* defined(J9VM_OPT_JITSERVER) */
+
+   switch (method)
+      {
+      case TR::java_util_zip_CRC32_update:
+         return !disableCRC32;
+#if JAVA_SPEC_VERSION <= 8
+      case TR::java_util_zip_CRC32_updateBytes:
+      case TR::java_util_zip_CRC32_updateByteBuffer:
+#else
+      case TR::java_util_zip_CRC32_updateBytes0:
+      case TR::java_util_zip_CRC32_updateByteBuffer0:
+#endif
+         return !disableCRC32 && comp->target().cpu.supportsFeature(OMR_FEATURE_X86_PCLMULQDQ);
+      case TR::java_util_zip_Adler32_update:
+         return !disableAdler32;
+      case TR::java_util_zip_Adler32_updateBytes:
+      case TR::java_util_zip_Adler32_updateByteBuffer:
+         return !disableAdler32 && comp->target().cpu.supportsFeature(OMR_FEATURE_X86_SSSE3);
+      default:
+         return false;
+      }
+   }
@@ -60,6 +60,8 @@ public:
    void initialize();
 
    TR::Linkage *createLinkage(TR_LinkageConventions lc);
+
+   bool supportsDirectChecksumKernelCall(TR::RecognizedMethod method);
    };
 
 } // namespace AMD64
@@ -0,0 +1,173 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+
+
+
+/*
+ * Adler-32 (java.util.zip.Adler32) kernels called from JIT compiled code in place of the
+ * zlib backed JNI natives. These are pure functions: they run without releasing VM
+ * access, so the buffer must not move while they run.
+ *
+ * Buffers of 32 bytes or more are summed 32 bytes at a time with SSSE3: PSADBW adds the
+ * bytes into s1 and PMADDUBSW weights them by their distance from the end of the block
+ * for s2. The sums are reduced modulo 65521 at least every ADLER32_NMAX bytes, as in
+ * zlib, so that the 32-bit lanes cannot overflow.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <emmintrin.h>
+#include <tmmintrin.h>
+
+#if defined(__GNUC__)
+#define ADLER32_SSSE3_TARGET __attribute__((target("ssse3")))
+#else /* defined(__GNUC__) */
+#define ADLER32_SSSE3_TARGET
+#endif /* defined(__GNUC__) */
+
+/* Largest prime smaller than 65536 */
+#define ADLER32_BASE 65521U
+/* Largest n such that 255n(n+1)/2 + (n+1)(ADLER32_BASE-1) fits in 32 bits */
+#define ADLER32_NMAX 5552
+#define ADLER32_BLOCK_SIZE 32
+
+static uint32_t
+adler32_scalar_update(uint32_t adler, const uint8_t *p, size_t len)
+   {
+   uint32_t s1 = adler & 0xffff;
+   uint32_t s2 = adler >> 16;
+
+   while (len > 0)
+      {
+      size_t n = (len < ADLER32_NMAX) ? len : ADLER32_NMAX;
+
+      len -= n;
+      while (n--)
+         {
+         s1 += *p++;
+         s2 += s1;
+         }
+      s1 %= ADLER32_BASE;
+      s2 %= ADLER32_BASE;
+      }
+
+   return (s2 << 16) | s1;
+   }
+
+/*
+ * Sum blocks * ADLER32_BLOCK_SIZE bytes into adler.
+ */
+static ADLER32_SSSE3_TARGET uint32_t
+adler32_ssse3_update(uint32_t adler, const uint8_t *p, size_t blocks)
+   {
+   /* Weights of the bytes of a block in s2: 32 for the first byte down to 1 for the last */
+   const __m128i tap1 = _mm_setr_epi8(32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17);
+   const __m128i tap2 = _mm_setr_epi8(16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+   const __m128i zero = _mm_setzero_si128();
+   const __m128i ones = _mm_set1_epi16(1);
+   uint32_t s1 = adler & 0xffff;
+   uint32_t s2 = adler >> 16;
+
+   while (blocks > 0)
+      {
+      size_t n = ADLER32_NMAX / ADLER32_BLOCK_SIZE;
+
+      if (n > blocks)
+         {
+         n = blocks;
+         }
+      blocks -= n;
+
+      /* vPrefixSums accumulates s1 as it was at the start of each block; each of those
+       * contributes ADLER32_BLOCK_SIZE times to s2. */
+      __m128i vPrefixSums = _mm_set_epi32(0, 0, 0, (int)(s1 * n));
+      __m128i vS2 = _mm_set_epi32(0, 0, 0, (int)s2);
+      __m128i vS1 = _mm_setzero_si128();
+
+      do
+         {
+         const __m128i bytes1 = _mm_loadu_si128((const __m128i *)p);
+         const __m128i bytes2 = _mm_loadu_si128((const __m128i *)(p + 16));
+
+         vPrefixSums = _mm_add_epi32(vPrefixSums, vS1);
+
+         vS1 = _mm_add_epi32(vS1, _mm_sad_epu8(bytes1, zero));
+         vS2 = _mm_add_epi32(vS2, _mm_madd_epi16(_mm_maddubs_epi16(bytes1, tap1), ones));
+         vS1 = _mm_add_epi32(vS1, _mm_sad_epu8(bytes2, zero));
+         vS2 = _mm_add_epi32(vS2, _mm_madd_epi16(_mm_maddubs_epi16(bytes2, tap2), ones));
+
+         p += ADLER32_BLOCK_SIZE;
+         }
+      while (--n);
+
+      vS2 = _mm_add_epi32(vS2, _mm_slli_epi32(vPrefixSums, 5));
+
+      /* Horizontal sums of the four lanes */
+      vS1 = _mm_add_epi32(vS1, _mm_shuffle_epi32(vS1, _MM_SHUFFLE(1, 0, 3, 2)));
+      vS1 = _mm_add_epi32(vS1, _mm_shuffle_epi32(vS1, _MM_SHUFFLE(2, 3, 0, 1)));
+      s1 += (uint32_t)_mm_cvtsi128_si32(vS1);
+
+      vS2 = _mm_add_epi32(vS2, _mm_shuffle_epi32(vS2, _MM_SHUFFLE(1, 0, 3, 2)));
+      vS2 = _mm_add_epi32(vS2, _mm_shuffle_epi32(vS2, _MM_SHUFFLE(2, 3, 0, 1)));
+      s2 = (uint32_t)_mm_cvtsi128_si32(vS2);
+
+      s1 %= ADLER32_BASE;
+      s2 %= ADLER32_BASE;
+      }
+
+   return (s2 << 16) | s1;
+   }
+
+/*
+ * Equivalent of Adler32.update(int adler, int b)
+ */
+uint32_t
+adler32_oneByte(uint32_t adler, uint32_t b)
+   {
+   uint32_t s1 = ((adler & 0xffff) + (b & 0xff)) % ADLER32_BASE;
+   uint32_t s2 = ((adler >> 16) + s1) % ADLER32_BASE;
+
+   return (s2 << 16) | s1;
+   }
+
+/*
+ * Equivalent of Adler32.updateBytes(int adler, byte[] b, int off, int len) and
+ * Adler32.updateByteBuffer(int adler, long addr, int off, int len).
+ * For the byte[] case the JIT adds the array header size to off.
+ * Must only be called if the processor supports SSSE3.
+ */
+uint32_t
+adler32_ssse3(uint32_t adler, const uint8_t *base, int32_t off, int32_t len)
+   {
+   const uint8_t *p = base + off;
+   size_t remaining = (size_t)len;
+   size_t blocks = remaining / ADLER32_BLOCK_SIZE;
+
+   if (blocks > 0)
+      {
+      adler = adler32_ssse3_update(adler, p, blocks);
+      p += blocks * ADLER32_BLOCK_SIZE;
+      remaining -= blocks * ADLER32_BLOCK_SIZE;
+      }
+
+   return adler32_scalar_update(adler, p, remaining);
+   }
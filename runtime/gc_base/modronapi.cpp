@@ -1053,6 +1053,18 @@ j9gc_set_allocation_sampling_interval(J9JavaVM *vm, UDATA samplingInterval)
 	}
 }
 
+/**
+ * Get the allocation sampling interval set by j9gc_set_allocation_sampling_interval().
+ *
+ * @parm[in] vm The J9JavaVM
+ * @return the allocation sampling interval, or UDATA_MAX if allocation sampling is disabled
+ */
+UDATA
+j9gc_get_allocation_sampling_interval(J9JavaVM *vm)
+{
+	return MM_GCExtensions::getExtensions(vm)->objectSamplingBytesGranularity;
+}
+
 /**
  * Sets the allocation threshold (VMDESIGN 2006) to trigger a J9HOOK_MM_ALLOCATION_THRESHOLD event
  * whenever an object is allocated on the heap whose is between the lower bound and the upper bound
@@ -756,6 +756,76 @@ public:
 		}
 		return inRange;
 	}
+
+	/**
+	 * Answer the address of a range of array elements if the whole range is
+	 * addressable through a single pointer, i.e. it does not span arraylet leaves.
+	 *
+	 * @param currentThread - The current thread
+	 * @param array - the primitive array
+	 * @param logElementSize - the log of the element size
+	 * @param index - the index of the first element of the range
+	 * @param count - the number of elements in the range
+	 *
+	 * @return the address of the element at index, or NULL if the range is empty or discontiguous
+	 */
+	static VMINLINE void *
+	contiguousRangeAddress(J9VMThread *currentThread, j9object_t array, UDATA logElementSize, UDATA index, UDATA count)
+	{
+		void *address = NULL;
+		if ((0 != count) && isContiguousRange(currentThread, index, count, logElementSize)) {
+			switch (logElementSize) {
+			case 3:
+				address = J9JAVAARRAY_EA(currentThread, array, index, U_64);
+				break;
+			case 2:
+				address = J9JAVAARRAY_EA(currentThread, array, index, U_32);
+				break;
+			case 1:
+				address = J9JAVAARRAY_EA(currentThread, array, index, U_16);
+				break;
+			default:
+				address = J9JAVAARRAY_EA(currentThread, array, index, U_8);
+				break;
+			}
+		}
+		return address;
+	}
+
+	/**
+	 * Inflate the Latin-1 elements of a byte array into a native UTF-16 buffer,
+	 * one arraylet leaf at a time rather than one element at a time.
+	 *
+	 * @param currentThread - The thread performing the copy
+	 * @param array - the byte array to copy from
+	 * @param index - the index to start the copy from
+	 * @param count - the number of elements to copy
+	 * @param destPtr - the address of the native UTF-16 buffer to copy into
+	 */
+	static VMINLINE void
+	inflateFromByteArray(J9VMThread *currentThread, j9object_t array, UDATA index, UDATA count, U_16 *destPtr)
+	{
+		UDATA arrayletLeafSizeInElements = currentThread->javaVM->arrayletLeafSize;
+
+		while (count > 0) {
+			UDATA copyCount = count;
+			if (!isContiguousRange(currentThread, index, count, 0)) {
+				copyCount = calculateElementsToCopyFromCurrentLeafForwardCopy(arrayletLeafSizeInElements, index);
+				if (copyCount > count) {
+					copyCount = count;
+				}
+			}
+
+			U_8 *srcPtr = J9JAVAARRAY_EA(currentThread, array, index, U_8);
+			for (UDATA i = 0; i < copyCount; i++) {
+				destPtr[i] = (U_16)srcPtr[i];
+			}
+
+			index += copyCount;
+			count -= copyCount;
+			destPtr += copyCount;
+		}
+	}
 };
 
 #endif /* ARRAYCOPYHELPERS_HPP_ */
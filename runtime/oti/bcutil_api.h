@@ -75,6 +75,38 @@ j9bcutil_buildRomClassIntoBuffer(U_8 * classFileBytes, UDATA classFileSize, J9Po
 		U_8 * varInfoBuffer, UDATA varInfoBufferSize,
 		U_8 ** classFileBufferPtr);
 
+/**
+* @brief Build a ROMClass for a class loader into memory allocated from the port library rather than into the class loader's segments.
+* The class file is checked and translated as it is when the class loader defines the class, but the VM-wide
+* translation buffers are not used, so the caller need not hold the class table mutex.
+* All data is laid down inline and no strings are interned, so the ROMClass can be copied elsewhere.
+* The caller frees the ROMClass with j9mem_free_memory().
+* @param javaVM
+* @param classLoader
+* @param className
+* @param classNameLength
+* @param classFileBytes
+* @param classFileSize
+* @param bctFlags
+* @param bcuFlags
+* @param romClassPtr the ROMClass, or NULL on failure
+* @return IDATA
+*/
+IDATA
+j9bcutil_buildRomClassIntoScratch(J9JavaVM *javaVM, J9ClassLoader *classLoader, U_8 *className, UDATA classNameLength,
+		U_8 *classFileBytes, UDATA classFileSize, UDATA bctFlags, UDATA bcuFlags, J9ROMClass **romClassPtr);
+
+/**
+* @brief Copy a ROMClass built by j9bcutil_buildRomClassIntoScratch() into the ROM segments of a class loader.
+* Warning: sender must hold class table mutex before calling.
+* @param javaVM
+* @param classLoader
+* @param romClass
+* @return the copy, or NULL if the segment memory could not be allocated
+*/
+J9ROMClass *
+j9bcutil_copyRomClassIntoClassLoader(J9JavaVM *javaVM, J9ClassLoader *classLoader, J9ROMClass *romClass);
+
 /**
 * @brief
 * @param javaVM
@@ -435,6 +435,14 @@ static_assert((LITERAL_STRLEN(J9_UNMODIFIABLE_CLASS_ANNOTATION) < (size_t)'/'),
 
 #define J9VM_NUM_OF_ENTRIES_IN_CLASS_JNIID_TABLE(romclass) ((romclass)->romMethodCount + (romclass)->romFieldCount)
 
+/* The class JNI ID table is followed by a small direct-mapped cache of the IDs returned by
+ * Get[Static]FieldID/Get[Static]MethodID for that lookup class. The first slot records the
+ * hotSwapCount the cache was filled under, the others hold IDs tagged with the lookup flags.
+ */
+#define J9VM_JNIID_LOOKUP_CACHE_ENTRIES 16
+#define J9VM_JNIID_LOOKUP_CACHE_SLOTS (J9VM_JNIID_LOOKUP_CACHE_ENTRIES + 1)
+#define J9VM_JNIID_LOOKUP_CACHE(jniIDs, romclass) ((UDATA *)(jniIDs) + J9VM_NUM_OF_ENTRIES_IN_CLASS_JNIID_TABLE(romclass))
+
 #define J9VM_SHOULD_CLEAR_JNIIDS_FOR_ASGCT(vm, classLoader) (J9_ARE_NO_BITS_SET((vm)->extendedRuntimeFlags2, J9_EXTENDED_RUNTIME2_NEVER_KEEP_JNI_IDS) \
 		&& ((classLoader)->asyncGetCallTraceUsed || J9_ARE_ANY_BITS_SET((vm)->extendedRuntimeFlags2, J9_EXTENDED_RUNTIME2_ALWAYS_KEEP_JNI_IDS)))
 
@@ -975,6 +975,10 @@ extern "C" {
 #define J9JFR_EVENT_TYPE_THREAD_STATISTICS 10
 #define J9JFR_EVENT_TYPE_MONITOR_ENTER 11
 #define J9JFR_EVENT_TYPE_SYSTEM_GC 12
+#define J9JFR_EVENT_TYPE_NATIVE_METHOD_SAMPLE 13
+#define J9JFR_EVENT_TYPE_OBJECT_ALLOCATION_SAMPLE 14
+#define J9JFR_EVENT_TYPE_GC_PHASE_PAUSE 15
+#define J9JFR_EVENT_TYPE_COMPILATION 16
 
 /* JFR thread states */
 
@@ -379,6 +379,7 @@ struct J9VMContinuation;
 typedef struct J9ThreadJFRState {
 	omrthread_thread_time_t prevThreadCPUTimes;
 	int64_t prevTimestamp;
+	I_64 compilationStartTicks;
 } J9ThreadJFRState;
 
 typedef struct J9JFRBufferWalkState {
@@ -393,6 +394,13 @@ typedef struct J9JFRBuffer {
 	U_8 *bufferCurrent;
 } J9JFRBuffer;
 
+/* A full thread local buffer waiting for the JFR writer thread */
+typedef struct J9JFRQueuedBuffer {
+	struct J9JFRQueuedBuffer *next;
+	U_8 *bufferStart;
+	UDATA bufferSize;
+} J9JFRQueuedBuffer;
+
 /* JFR event structures */
 
 #define J9JFR_EVENT_COMMON_FIELDS \
@@ -513,6 +521,33 @@ typedef struct J9JFRSystemGC {
 
 #define J9JFRSYSTEMGC_STACKTRACE(jfrEvent) ((UDATA *)(((J9JFRSystemGC *)(jfrEvent)) + 1))
 
+/* Variable-size structure - stackTraceSize worth of UDATA follow the fixed portion */
+typedef struct J9JFRObjectAllocationSample {
+	J9JFR_EVENT_WITH_STACKTRACE_FIELDS
+	struct J9Class *objectClass;
+	UDATA weight;
+} J9JFRObjectAllocationSample;
+
+#define J9JFROBJECTALLOCATIONSAMPLE_STACKTRACE(jfrEvent) ((UDATA *)(((J9JFRObjectAllocationSample *)(jfrEvent)) + 1))
+
+typedef struct J9JFRGCPhasePause {
+	J9JFR_EVENT_COMMON_FIELDS
+	I_64 duration;
+	U_32 gcId;
+	BOOLEAN globalGC;
+} J9JFRGCPhasePause;
+
+typedef struct J9JFRCompilation {
+	J9JFR_EVENT_COMMON_FIELDS
+	I_64 duration;
+	struct J9Method *method;
+	U_32 compileId;
+	U_16 compileLevel;
+	BOOLEAN succeeded;
+	BOOLEAN isOSR;
+	UDATA codeSize;
+} J9JFRCompilation;
+
 #endif /* defined(J9VM_OPT_JFR) */
 
 /* @ddr_namespace: map_to_type=J9CfrError */
@@ -1449,7 +1484,7 @@ typedef struct J9SharedCacheHeader {
 	UDATA corruptValue;
 	UDATA lastMetadataType;
 	UDATA writerCount;
-	UDATA unused5;
+	UDATA romClassIndexSRP; /* offset from the header of the J9SharedROMClassIndex, 0 if there is none */
 	UDATA unused6;
 	U_32 softMaxBytes;
 	UDATA unused8;
@@ -1509,6 +1544,7 @@ typedef struct J9SharedCacheAPI {
 	U_8 usingJITServerAOTCacheLayer;
 #endif /* defined(J9VM_OPT_JITSERVER) */
 	I_32 newStartupHints;
+	U_32 timestampCheckInterval;
 } J9SharedCacheAPI;
 
 typedef struct J9SharedClassConfig {
@@ -2120,6 +2156,7 @@ typedef struct J9TranslationBufferSet {
 	U_8* classFileError;
 	UDATA classFileSize;
 	void* romClassBuilder;
+	void* romClassPrebuilder;
 	IDATA  ( *findLocallyDefinedClassFunction)(struct J9VMThread * vmThread, struct J9Module * j9module, U_8 * className, U_32 classNameLength, struct J9ClassLoader * classLoader, UDATA options, struct J9TranslationLocalBuffer *localBuffer) ;
 	struct J9Class*  ( *internalDefineClassFunction)(struct J9VMThread* vmThread, void* className, UDATA classNameLength, U_8* classData, UDATA classDataLength, j9object_t classDataObject, struct J9ClassLoader* classLoader, j9object_t protectionDomain, UDATA options, struct J9ROMClass *existingROMClass, struct J9Class *hostClass, struct J9TranslationLocalBuffer *localBuffer) ;
 	I_32  ( *closeZipFileFunction)(struct J9VMInterface* vmi, struct VMIZipFile* zipFile) ;
@@ -4537,7 +4574,7 @@ typedef struct J9JITConfig {
 	void *serverAOTMethodSet;
 	UDATA serverAOTQueryThread;
 #endif /* defined(J9VM_OPT_JITSERVER) */
-	I_32 lowCodeCacheFreeSpace; /* bool set to 1 when the JIT detects a very low amount of free code cache space; never reset */
+	I_32 lowCodeCacheFreeSpace; /* bool set to 1 when the JIT detects a very low amount of free code cache space; reset when code cache space is reclaimed */
 } J9JITConfig;
 
 #if defined(J9VM_OPT_CRIU_SUPPORT)
@@ -4997,6 +5034,7 @@ typedef struct J9MemoryManagerFunctions {
 	UDATA  ( *j9gc_arraylet_getLeafLogSize)(struct J9JavaVM* javaVM) ;
 	void  ( *j9gc_get_offheap_data)(struct J9JavaVM *javaVM, void **offheapControlStructure, void **base, void **top, UDATA *usage);
 	void  ( *j9gc_set_allocation_sampling_interval)(struct J9JavaVM *vm, UDATA samplingInterval);
+	UDATA  ( *j9gc_get_allocation_sampling_interval)(struct J9JavaVM *vm);
 	void  ( *j9gc_set_allocation_threshold)(struct J9VMThread *vmThread, UDATA low, UDATA high) ;
 	void  ( *j9gc_objaccess_recentlyAllocatedObject)(struct J9VMThread *vmThread, J9Object *dstObject) ;
 	void  ( *j9gc_objaccess_postStoreClassToClassLoader)(struct J9VMThread *vmThread, J9ClassLoader *destClassLoader, J9Class *srcClass) ;
@@ -6008,6 +6046,15 @@ typedef struct JFRState {
 	uint64_t prevContextSwitches;
 	omrthread_monitor_t typeIDMonitor;
 	jlong typeIDcount;
+	/* Type IDs looked up by name in the metadata blob, 0 if the type is not described there */
+	U_64 objectAllocationSampleTypeID;
+	U_64 gcPhasePauseTypeID;
+	U_64 compilationTypeID;
+	U_64 compilationWithCompilerTypeID;
+	U_64 compilerTypeTypeID;
+	I_64 gcStartTicks;
+	U_32 gcCount;
+	U_32 compilationCount;
 } JFRState;
 
 typedef struct J9ReflectFunctionTable {
@@ -6554,6 +6601,12 @@ typedef struct J9JavaVM {
 	omrthread_monitor_t jfrSamplerMutex;
 	omrthread_t jfrSamplerThread;
 	UDATA jfrSamplerState;
+	/* Lock-free stack of full thread buffers, consumed by the writer thread */
+	J9JFRQueuedBuffer * volatile jfrQueuedBuffers;
+	volatile UDATA jfrQueuedBytes;
+	omrthread_monitor_t jfrWriterMutex;
+	omrthread_t jfrWriterThread;
+	UDATA jfrWriterState;
 	IDATA jfrAsyncKey;
 	IDATA jfrThreadCPULoadAsyncKey;
 #endif /* defined(J9VM_OPT_JFR) */
@@ -6592,6 +6645,11 @@ typedef struct J9JavaVM {
 #define J9JFR_SAMPLER_STATE_STOP 2
 #define J9JFR_SAMPLER_STATE_DEAD 3
 
+#define J9JFR_WRITER_STATE_UNINITIALIZED 0
+#define J9JFR_WRITER_STATE_RUNNING 1
+#define J9JFR_WRITER_STATE_STOP 2
+#define J9JFR_WRITER_STATE_DEAD 3
+
 #define J9VM_PHASE_STARTUP  1
 #define J9VM_PHASE_NOT_STARTUP  2
 #define J9VM_PHASE_LATE_SCC_DISCLAIM 3
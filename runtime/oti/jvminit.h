@@ -505,6 +505,9 @@ enum INIT_STAGE {
 #define VMOPT_XXSHARECLASSESENABLEBCI "-XX:ShareClassesEnableBCI"
 #define VMOPT_XXSHARECLASSESDISABLEBCI "-XX:ShareClassesDisableBCI"
 
+#define VMOPT_XXROMCLASSPREBUILDLIST_EQUALS "-XX:ROMClassPrebuildList="
+#define VMOPT_XXROMCLASSPREBUILDTHREADS_EQUALS "-XX:ROMClassPrebuildThreads="
+
 #define VMOPT_XXPORTABLESHAREDCACHE "-XX:+PortableSharedCache"
 #define VMOPT_XXNOPORTABLESHAREDCACHE "-XX:-PortableSharedCache"
 
@@ -191,6 +191,25 @@ typedef struct ByteDataWrapper {
 #define BDWINPRIVATEUSE(bdw) J9SHR_READMEM((bdw)->inPrivateUse)
 #define BDWPRIVATEOWNERID(bdw) J9SHR_READMEM((bdw)->privateOwnerID)
 
+/* Prebuilt ROMClass lookup index, stored as J9SHR_DATA_TYPE_VM byte data and referenced by J9SharedCacheHeader.romClassIndexSRP.
+ * All offsets are relative to the J9SharedCacheHeader of the cache layer holding the index. */
+typedef struct J9SharedROMClassIndexSlot {
+	U_32 hash; /* SH_Manager::generateHash() of the class name */
+	U_32 itemOffset; /* offset of the ShcItem, 0 if the slot is empty */
+} J9SharedROMClassIndexSlot;
+
+typedef struct J9SharedROMClassIndex {
+	U_32 slotCount; /* power of two */
+	U_32 itemCount;
+	U_32 coveredOffset; /* ROMClass, orphan and scoped ROMClass items at or above this offset are all in the index */
+	U_32 padding;
+	/* followed by slotCount J9SharedROMClassIndexSlot */
+} J9SharedROMClassIndex;
+
+#define J9SHR_ROMCLASS_INDEX_KEY "J9ROMClassLookupIndex"
+#define ROMCLASSINDEXSLOTS(idx) ((J9SharedROMClassIndexSlot*)(((U_8*)(idx)) + sizeof(J9SharedROMClassIndex)))
+#define ROMCLASSINDEXLEN(slotCount) (sizeof(J9SharedROMClassIndex) + ((slotCount) * sizeof(J9SharedROMClassIndexSlot)))
+
 typedef struct CacheletHints {
 	UDATA length; /* in bytes */
 	UDATA dataType;
@@ -131,6 +131,9 @@
 #define J9SHR_RUNTIMEFLAG2_TEST_DOUBLE_PAGESIZE 2
 #define J9SHR_RUNTIMEFLAG2_TEST_HALF_PAGESIZE 4
 #define J9SHR_RUNTIMEFLAG2_SHARE_LAMBDAFORM 8
+#define J9SHR_RUNTIMEFLAG2_HUGE_PAGES 16
+#define J9SHR_RUNTIMEFLAG2_PREFAULT 32
+#define J9SHR_RUNTIMEFLAG2_RECLAIM_STALE 64
 
 #define J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT  1
 #define J9SHR_VERBOSEFLAG_ENABLE_VERBOSE  2
@@ -171,6 +174,8 @@
 #define J9SHR_EXTRA_FLAGS_MPROTECT_PARTIAL_PAGES 0x40
 #define J9SHR_EXTRA_FLAGS_RESTRICT_CLASSPATHS 0x80
 #define J9SHR_EXTRA_FLAGS_MPROTECT_PARTIAL_PAGES_ON_STARTUP 0x100
+/* The cache is being replaced by a new cache of the same name; JVMs attached to it continue to use it */
+#define J9SHR_EXTRA_FLAGS_CACHE_REPLACED 0x200
 
 #define J9SHR_RESOURCE_TYPE_UNKNOWN 0
 #define J9SHR_ATTACHED_DATA_NO_FLAGS 0
@@ -63,6 +63,8 @@ extern "C" {
 
 static char* formatAttachedDataString(J9VMThread* currentThread, U_8 *attachedData, UDATA attachedDataLength, char *attachedDataStringBuffer, UDATA bufferLength);
 static void checkROMClassUTF8SRPs(J9ROMClass *romClass);
+static UDATA staleROMClassHashFn(void *entry, void *userData);
+static UDATA staleROMClassHashEqualFn(void *leftEntry, void *rightEntry, void *userData);
 /* If you make this sleep a lot longer, it almost eliminates store contention
  * because the VMs get out of step with each other, but you delay excessively */
 #define WRITE_HASH_WAIT_MAX_MICROS 80000
@@ -289,6 +291,10 @@ SH_CacheMap::initialize(J9JavaVM* vm, J9SharedClassConfig* sharedClassConfig, Bl
 	_isAssertEnabled = true;
 	_metadataReleaseCounter = 0;
 	_ccPool = NULL;
+	_writeBatchMutex = NULL;
+	_writeBatchHead = NULL;
+	_writeBatchTail = NULL;
+	_writeBatchLeader = NULL;
 
 	_managers = SH_Managers::newInstance(vm, (SH_Managers *)allocPtr);
 
@@ -380,6 +386,13 @@ SH_CacheMap::cleanup(J9VMThread* currentThread)
 		omrthread_monitor_destroy(_refreshMutex);
 		_refreshMutex = NULL;
 	}
+	if (_writeBatchMutex) {
+		omrthread_monitor_destroy(_writeBatchMutex);
+		_writeBatchMutex = NULL;
+	}
+	if (_tsm) {
+		_tsm->cleanup(currentThread);
+	}
 	if (_ccPool) {
 		pool_kill(_ccPool);
 	}
@@ -443,6 +456,8 @@ SH_CacheMap::startup(J9VMThread* currentThread, J9SharedClassPreinitConfig* pico
 	SH_CompositeCacheImpl* ccNext = NULL;
 	SH_CompositeCacheImpl* ccPrevious = NULL;
 	bool isCacheUniqueIdStored = false;
+	bool staleCacheChecked = false;
+	bool clearReplacedMark = false;
 
 	_actualSize = (U_32)piconfig->sharedClassCacheSize;
 
@@ -466,6 +481,11 @@ SH_CacheMap::startup(J9VMThread* currentThread, J9SharedClassPreinitConfig* pico
 		return -1;
 	}
 
+	/* Stores are not batched if the mutex cannot be created */
+	if (omrthread_monitor_init(&_writeBatchMutex, 0)) {
+		_writeBatchMutex = NULL;
+	}
+
 	/* _ccHead->startup will set the _actualSize to the real cache size */
 	U_32 cacheFileSize = 0;
 	bool doRetry = false;
@@ -504,6 +524,37 @@ SH_CacheMap::startup(J9VMThread* currentThread, J9SharedClassPreinitConfig* pico
 					goto error;
 				}
 
+				if (isCcHead && !staleCacheChecked) {
+					staleCacheChecked = true;
+					if ((NULL != _sharedClassConfig)
+						&& J9_ARE_ALL_BITS_SET(_sharedClassConfig->runtimeFlags2, J9SHR_RUNTIMEFLAG2_RECLAIM_STALE)
+						&& replaceStaleCache(currentThread, ccToUse)
+					) {
+						/* JVMs already attached to the cache continue to use it. JVMs started after it is deleted use the new cache. */
+						cacheFileSize = ccToUse->getTotalSize();
+						if (0 == ccToUse->deleteCache(currentThread, J9_ARE_NO_BITS_SET(_verboseFlags, J9SHR_VERBOSEFLAG_ENABLE_VERBOSE))) {
+							piconfig->sharedClassCacheSize = cacheFileSize;
+						} else {
+							/* deleteCache() has detached the cache. Start up with the existing cache again and remove
+							 * the replaced mark, otherwise no JVM would try to replace the cache again.
+							 */
+							CACHEMAP_TRACE1(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE, J9NLS_WARNING, J9NLS_SHRC_CM_STALE_CACHE_NOT_DELETED, _cacheName);
+							clearReplacedMark = true;
+						}
+						ccToUse->cleanup(currentThread);
+						doRetry = true;
+						continue;
+					}
+				} else if (isCcHead && clearReplacedMark) {
+					clearReplacedMark = false;
+					if (!ccToUse->isRunningReadOnly() && (0 == ccToUse->enterWriteMutex(currentThread, false, fnName))) {
+						if (ccToUse->isCacheReplaced(currentThread)) {
+							ccToUse->clearCacheReplaced(currentThread);
+						}
+						ccToUse->exitWriteMutex(currentThread, fnName);
+					}
+				}
+
 				if (!isCcHead) {
 					if (NULL == appendCacheDescriptorList(currentThread, _sharedClassConfig, ccToUse)) {
 						CACHEMAP_TRACE(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT, J9NLS_ERROR, J9NLS_SHRC_CM_FAILED_ALLOC_DESCRIPTOR);
@@ -667,6 +718,10 @@ error:
 			runtimeFlags = _readOnlyCacheRuntimeFlags;
 		}
 		bool isReadOnly = ccToUse->isRunningReadOnly();
+
+		if ((NULL != _sharedClassConfig) && J9_ARE_ALL_BITS_SET(_sharedClassConfig->runtimeFlags2, J9SHR_RUNTIMEFLAG2_PREFAULT)) {
+			ccToUse->prefault(currentThread);
+		}
 		/* THREADING: We want the cache mutex here as we are reading all available data. Don't want updates happening as we read. */
 
 		if (ccToUse->enterWriteMutex(currentThread, false, fnName) == 0) {
@@ -788,6 +843,129 @@ SH_CacheMap::handleStartupError(J9VMThread* currentThread, SH_CompositeCacheImpl
 
 }
 
+/* Entry of the table used by replaceStaleCache() to count each ROMClass once, however many wrappers refer to it */
+typedef struct StaleROMClassEntry {
+	J9ROMClass* romClass;
+	bool live;
+} StaleROMClassEntry;
+
+static UDATA
+staleROMClassHashFn(void *entry, void *userData)
+{
+	return (UDATA)((StaleROMClassEntry*)entry)->romClass;
+}
+
+static UDATA
+staleROMClassHashEqualFn(void *leftEntry, void *rightEntry, void *userData)
+{
+	return ((StaleROMClassEntry*)leftEntry)->romClass == ((StaleROMClassEntry*)rightEntry)->romClass;
+}
+
+/**
+ * Check whether a full cache should be replaced by a new empty cache because most of its used space is stale.
+ * Only the first JVM to find this replaces the cache. The cache is marked so that other JVMs which are already
+ * attached to it continue to use it until they exit.
+ *
+ * @param [in] currentThread  The current thread
+ * @param [in] cache  The top layer cache, which has been started but not read
+ *
+ * @return true if the caller should delete the cache and create a new one, false otherwise
+ *
+ * THREADING: Only ever single threaded
+ */
+bool
+SH_CacheMap::replaceStaleCache(J9VMThread* currentThread, SH_CompositeCacheImpl* cache)
+{
+	const char* fnName = "replaceStaleCache";
+	bool replace = false;
+	U_32 usedBytes = 0;
+	UDATA staleBytes = 0;
+	PORT_ACCESS_FROM_PORT(_portlib);
+
+	if (cache->isRunningReadOnly()
+		|| J9_ARE_NO_BITS_SET(*_runtimeFlags, J9SHR_RUNTIMEFLAG_ENABLE_PERSISTENT_CACHE)
+		|| J9_ARE_ANY_BITS_SET(*_runtimeFlags, J9SHR_RUNTIMEFLAG_ENABLE_READONLY | J9SHR_RUNTIMEFLAG_ENABLE_STATS | J9SHR_RUNTIMEFLAG_DO_NOT_CREATE_CACHE)
+	) {
+		return false;
+	}
+
+	if (cache->enterWriteMutex(currentThread, false, fnName) != 0) {
+		return false;
+	}
+
+	if (!cache->isCacheReplaced(currentThread) && cache->isBlockSpaceMarkedFull(currentThread)) {
+		U_8* cacheBase = (U_8*)cache->getCacheHeaderAddress();
+		ShcItem* it = NULL;
+		/* A ROMClass may be referred to by several wrappers. It is stale only if all of them are stale. */
+		J9HashTable* romClassTable = hashTableNew(OMRPORT_FROM_J9PORT(_portlib), J9_GET_CALLSITE(), 0, sizeof(StaleROMClassEntry), sizeof(char *), 0, J9MEM_CATEGORY_CLASSES, staleROMClassHashFn, staleROMClassHashEqualFn, NULL, NULL);
+
+		if (NULL != romClassTable) {
+			J9HashTableState walkState;
+			StaleROMClassEntry* entry = NULL;
+			bool addFailed = false;
+
+			usedBytes = cache->getUsedBytes();
+			cache->findStart(currentThread);
+			while (NULL != (it = (ShcItem*)cache->nextEntry(currentThread, NULL))) {
+				ShcItemHdr* ih = (ShcItemHdr*)ITEMEND(it);
+				bool isStale = (0 != cache->stale((BlockPtr)ih));
+
+				if (isStale) {
+					staleBytes += CCITEMLEN(ih);
+				}
+				if ((TYPE_ROMCLASS == ITEMTYPE(it)) || (TYPE_SCOPED_ROMCLASS == ITEMTYPE(it))) {
+					ROMClassWrapper* rcw = (ROMClassWrapper*)ITEMDATA(it);
+
+#if defined(J9VM_OPT_MULTI_LAYER_SHARED_CLASS_CACHE)
+					/* Only count ROMClasses in this layer */
+					if (rcw->romClassOffset.cacheLayer == (U_32)cache->getLayer())
+#endif /* defined(J9VM_OPT_MULTI_LAYER_SHARED_CLASS_CACHE) */
+					{
+						StaleROMClassEntry newEntry;
+
+						newEntry.romClass = (J9ROMClass*)(cacheBase + rcw->romClassOffset.offset);
+						newEntry.live = false;
+						entry = (StaleROMClassEntry*)hashTableAdd(romClassTable, &newEntry);
+						if (NULL == entry) {
+							addFailed = true;
+							break;
+						}
+						if (!isStale) {
+							entry->live = true;
+						}
+					}
+				}
+			}
+			/* readCache() starts from the first entry */
+			cache->findStart(currentThread);
+
+			if (!addFailed) {
+				entry = (StaleROMClassEntry*)hashTableStartDo(romClassTable, &walkState);
+				while (NULL != entry) {
+					if (!entry->live) {
+						staleBytes += entry->romClass->romSize;
+					}
+					entry = (StaleROMClassEntry*)hashTableNextDo(&walkState);
+				}
+
+				if ((usedBytes > 0) && ((staleBytes * 100) >= ((UDATA)usedBytes * CM_RECLAIM_STALE_PERCENT))) {
+					cache->setCacheReplaced(currentThread);
+					replace = true;
+				}
+			}
+			hashTableFree(romClassTable);
+		}
+	}
+
+	cache->exitWriteMutex(currentThread, fnName);
+
+	Trc_SHR_CM_replaceStaleCache_Event(currentThread, cache, usedBytes, staleBytes, replace);
+	if (replace) {
+		CACHEMAP_TRACE3(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE, J9NLS_INFO, J9NLS_SHRC_CM_STALE_CACHE_REPLACED, _cacheName, staleBytes, usedBytes);
+	}
+	return replace;
+}
+
 /* Assume cc is initialized OK */
 /* THREADING: Only ever single threaded */
 /* Creates a new ROMClass memory segment and adds it to the avl tree */
@@ -1137,6 +1315,187 @@ SH_CacheMap::readCacheUpdates(J9VMThread* currentThread)
 	return itemsRead;
 }
 
+/* The items of one manager found by readCache(). A lane is stored by a single thread, in cache order. */
+typedef struct ReadCacheLane {
+	SH_Manager* manager;
+	const ShcItem** items;
+	UDATA count;
+	UDATA capacity;
+	bool failed;
+} ReadCacheLane;
+
+/* The items found by a startup readCache(), grouped by manager. Lane 0 belongs to the ROMClass manager,
+ * which is always stored by the thread reading the cache. */
+typedef struct ReadCacheWork {
+	J9JavaVM* vm;
+	J9PortLibrary* portlib;
+	SH_CompositeCacheImpl* cache;
+	omrthread_monitor_t monitor;
+	ReadCacheLane lanes[CM_READ_CACHE_MAX_LANES];
+	UDATA laneCount;
+	UDATA nextLane;
+	UDATA itemCount;
+	UDATA activeThreads;
+} ReadCacheWork;
+
+/**
+ * Queue an item to be stored by its manager.
+ * @return false if the item could not be queued
+ */
+static bool
+queueReadCacheItem(ReadCacheWork* work, SH_Manager* manager, const ShcItem* item)
+{
+	ReadCacheLane* lane = NULL;
+	PORT_ACCESS_FROM_PORT(work->portlib);
+
+	for (UDATA i = 0; i < work->laneCount; i++) {
+		if (manager == work->lanes[i].manager) {
+			lane = &work->lanes[i];
+			break;
+		}
+	}
+	if (NULL == lane) {
+		if (CM_READ_CACHE_MAX_LANES == work->laneCount) {
+			return false;
+		}
+		lane = &work->lanes[work->laneCount];
+		lane->manager = manager;
+		work->laneCount += 1;
+	}
+	if (lane->count == lane->capacity) {
+		UDATA newCapacity = (0 == lane->capacity) ? CM_READ_CACHE_LANE_INITIAL_ITEMS : (lane->capacity * 2);
+		const ShcItem** newItems = (const ShcItem**)j9mem_reallocate_memory((void*)lane->items, newCapacity * sizeof(ShcItem*), J9MEM_CATEGORY_CLASSES);
+
+		if (NULL == newItems) {
+			return false;
+		}
+		lane->items = newItems;
+		lane->capacity = newCapacity;
+	}
+	lane->items[lane->count] = item;
+	lane->count += 1;
+	work->itemCount += 1;
+	return true;
+}
+
+static void
+storeReadCacheLane(J9VMThread* currentThread, SH_CompositeCacheImpl* cache, ReadCacheLane* lane)
+{
+	for (UDATA i = 0; i < lane->count; i++) {
+		if (!lane->manager->storeNew(currentThread, lane->items[i], cache)) {
+			lane->failed = true;
+			break;
+		}
+	}
+}
+
+static int J9THREAD_PROC
+readCacheWorkerProc(void* entryArg)
+{
+	ReadCacheWork* work = (ReadCacheWork*)entryArg;
+	J9JavaVM* vm = work->vm;
+	J9VMThread* workerThread = NULL;
+
+	/* The managers' storeNew() paths expect an attached thread. The startup read runs before the JCL
+	 * is bootstrapped, so the worker attaches without a java.lang.Thread object. A worker which cannot
+	 * attach leaves its lanes to the thread reading the cache, which helps with the remaining lanes. */
+	if (JNI_OK == vm->internalVMFunctions->internalAttachCurrentThread(vm, &workerThread, NULL,
+			J9_PRIVATE_FLAGS_DAEMON_THREAD | J9_PRIVATE_FLAGS_NO_OBJECT | J9_PRIVATE_FLAGS_SYSTEM_THREAD,
+			omrthread_self())) {
+		omrthread_monitor_enter(work->monitor);
+		while (work->nextLane < work->laneCount) {
+			ReadCacheLane* lane = &work->lanes[work->nextLane];
+
+			work->nextLane += 1;
+			omrthread_monitor_exit(work->monitor);
+			storeReadCacheLane(workerThread, work->cache, lane);
+			omrthread_monitor_enter(work->monitor);
+		}
+		omrthread_monitor_exit(work->monitor);
+		vm->internalVMFunctions->DetachCurrentThread((JavaVM*)vm);
+	}
+
+	omrthread_monitor_enter(work->monitor);
+	work->activeThreads -= 1;
+	omrthread_monitor_notify_all(work->monitor);
+	omrthread_exit(work->monitor);
+
+	/* NO GUARANTEED EXECUTION BEYOND THIS POINT */
+
+	return 0;
+}
+
+/**
+ * Store the items queued by readCache() in the manager hashtables. When there are enough items,
+ * the lanes of the managers other than the ROMClass manager are stored by worker threads while
+ * the current thread stores the ROMClasses.
+ *
+ * @return true if all items were stored
+ */
+static bool
+storeReadCacheItems(J9VMThread* currentThread, ReadCacheWork* work)
+{
+	J9JavaVM* vm = currentThread->javaVM;
+	UDATA threadCount = 0;
+	bool result = true;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	work->nextLane = 1;
+	if ((work->itemCount >= CM_READ_CACHE_PARALLEL_MIN_ITEMS) && (work->laneCount > 1)) {
+		threadCount = j9sysinfo_get_number_CPUs_by_type(J9PORT_CPU_TARGET);
+		threadCount = (threadCount > 1) ? (threadCount - 1) : 0;
+		threadCount = OMR_MIN(threadCount, OMR_MIN(work->laneCount - 1, CM_READ_CACHE_MAX_THREADS));
+	}
+	if ((threadCount > 0) && (0 == omrthread_monitor_init(&work->monitor, 0))) {
+		omrthread_monitor_enter(work->monitor);
+		for (UDATA i = 0; i < threadCount; i++) {
+			if (J9THREAD_SUCCESS != vm->internalVMFunctions->createThreadWithCategory(NULL, vm->defaultOSStackSize, J9THREAD_PRIORITY_NORMAL,
+					0, readCacheWorkerProc, work, J9THREAD_CATEGORY_SYSTEM_THREAD)
+			) {
+				break;
+			}
+			work->activeThreads += 1;
+		}
+		omrthread_monitor_exit(work->monitor);
+		Trc_SHR_CM_storeReadCacheItems_Event(currentThread, work->itemCount, work->laneCount, work->activeThreads);
+
+		storeReadCacheLane(currentThread, work->cache, &work->lanes[0]);
+
+		/* Help with the remaining lanes, then wait for the workers to finish theirs */
+		omrthread_monitor_enter(work->monitor);
+		while (work->nextLane < work->laneCount) {
+			ReadCacheLane* lane = &work->lanes[work->nextLane];
+
+			work->nextLane += 1;
+			omrthread_monitor_exit(work->monitor);
+			storeReadCacheLane(currentThread, work->cache, lane);
+			omrthread_monitor_enter(work->monitor);
+		}
+		while (0 != work->activeThreads) {
+			omrthread_monitor_wait(work->monitor);
+		}
+		omrthread_monitor_exit(work->monitor);
+		omrthread_monitor_destroy(work->monitor);
+		work->monitor = NULL;
+	} else {
+		for (UDATA i = 0; i < work->laneCount; i++) {
+			storeReadCacheLane(currentThread, work->cache, &work->lanes[i]);
+		}
+	}
+
+	for (UDATA i = 0; i < work->laneCount; i++) {
+		if (work->lanes[i].failed) {
+			result = false;
+		}
+		j9mem_free_memory((void*)work->lanes[i].items);
+		work->lanes[i].items = NULL;
+		work->lanes[i].count = 0;
+		work->lanes[i].capacity = 0;
+	}
+	work->itemCount = 0;
+	return result;
+}
+
 /* THREADING: MUST be single-threaded - protected by refreshMutex or cache write mutex
  * If expectedUpdates == -1, this indicates to read until no more data is found.
  * Otherwise, only read expectedUpdates entries.
@@ -1152,6 +1511,9 @@ SH_CacheMap::readCache(J9VMThread* currentThread, SH_CompositeCacheImpl* cache,
 	IDATA result = 0;
 	IDATA expectedCntr = expectedUpdates;
 	SH_Manager* manager = NULL;
+	U_8* indexedItemsStart = NULL;
+	ReadCacheWork work;
+	ReadCacheWork* parallelWork = NULL;
 	PORT_ACCESS_FROM_PORT(_portlib);
 
 	if (!cache->hasWriteMutex(currentThread)) {
@@ -1160,6 +1522,29 @@ SH_CacheMap::readCache(J9VMThread* currentThread, SH_CompositeCacheImpl* cache,
 
 	Trc_SHR_CM_readCache_Entry(currentThread, expectedUpdates);
 
+	if ((-1 == expectedUpdates) && (false == startupForStats) && (NULL != currentThread)) {
+		/* The ROMClasses covered by a prebuilt lookup index are not added to the hashtable at startup */
+		const J9SharedROMClassIndex* romClassIndex = cache->getROMClassIndex();
+
+		if (NULL != romClassIndex) {
+			SH_ROMClassManager* localRCM = getROMClassManager(currentThread);
+			U_8* cacheBase = (U_8*)cache->getCacheHeaderAddress();
+
+			if ((NULL != localRCM) && localRCM->useLookupIndex(currentThread, romClassIndex, cacheBase, cache)) {
+				indexedItemsStart = cacheBase + romClassIndex->coveredOffset;
+			}
+		}
+
+		/* Group the items by manager, so they can be stored on several threads once the walk is complete */
+		memset(&work, 0, sizeof(work));
+		work.vm = currentThread->javaVM;
+		work.portlib = _portlib;
+		work.cache = cache;
+		work.lanes[0].manager = _rcm;
+		work.laneCount = 1;
+		parallelWork = &work;
+	}
+
 	/* For each cached item, find a suitable manager and store it */
 	do {
 		it = (ShcItem*)cache->nextEntry(currentThread, NULL);		/* IMPORTANT: Do not skip stale entries (can end up with lone orphans) */
@@ -1174,6 +1559,12 @@ SH_CacheMap::readCache(J9VMThread* currentThread, SH_CompositeCacheImpl* cache,
 				}
 				Trc_SHR_CM_readCache_Exit1(currentThread, it);
 				result = CM_CACHE_CORRUPT;
+			} else if ((NULL != indexedItemsStart)
+				&& ((U_8*)it >= indexedItemsStart)
+				&& ((TYPE_ROMCLASS == itemType) || (TYPE_ORPHAN == itemType) || (TYPE_SCOPED_ROMCLASS == itemType))
+			) {
+				/* Found by the ROMClass manager through the lookup index */
+				++result;
 			} else {
 				rc = getAndStartManagerForType(currentThread, itemType, &manager);
 
@@ -1183,7 +1574,21 @@ SH_CacheMap::readCache(J9VMThread* currentThread, SH_CompositeCacheImpl* cache,
 					++result;
 				} else if ((rc > 0) && ((UDATA)rc == itemType)) {
 					/* Success - we have a started manager */
-					if (manager->storeNew(currentThread, it, cache)) {
+					bool stored = false;
+
+					if (NULL != parallelWork) {
+						stored = queueReadCacheItem(parallelWork, manager, it);
+						if (!stored) {
+							/* Store the queued items, then continue on this thread so that each manager still sees its items in cache order */
+							bool queuedStored = storeReadCacheItems(currentThread, parallelWork);
+
+							parallelWork = NULL;
+							stored = queuedStored && manager->storeNew(currentThread, it, cache);
+						}
+					} else {
+						stored = manager->storeNew(currentThread, it, cache);
+					}
+					if (stored) {
 						if (expectedCntr != -1) {
 							--expectedCntr;
 						}
@@ -1202,6 +1607,14 @@ SH_CacheMap::readCache(J9VMThread* currentThread, SH_CompositeCacheImpl* cache,
 		}
 	} while ((it != NULL) && (result != CM_READ_CACHE_FAILED) && (result != CM_CACHE_CORRUPT) && (expectedCntr==-1 || expectedCntr>0));
 
+	if (NULL != parallelWork) {
+		if (!storeReadCacheItems(currentThread, parallelWork) && (result >= 0)) {
+			CACHEMAP_TRACE(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE_DEFAULT, J9NLS_ERROR, J9NLS_SHRC_CM_HASHTABLE_ADD_FAILURE);
+			Trc_SHR_CM_readCache_Exit2(currentThread);
+			result = CM_READ_CACHE_FAILED;
+		}
+	}
+
 	if ((false == startupForStats) && (cache->isCacheCorrupt())) {
 		reportCorruptCache(currentThread, cache);
 		if (NULL == it) {
@@ -2854,14 +3267,151 @@ SH_CacheMap::addROMClassResourceToCache(J9VMThread* currentThread, const void* r
 	return resultWrapper;
 }
 
+/**
+ * Queue a store behind the thread of this JVM which is committing stores, if there is one.
+ * If there is no such thread, the current thread becomes the one which commits the queued stores
+ * and must call commitWriteBatch() once it has stored its own item.
+ *
+ * A store from other threads is committed while the write mutex is still held for this one, so
+ * each JVM enters the write mutex once for a batch of stores rather than once per store.
+ *
+ * Lock order: a queued thread waits for the committing thread, which enters the write mutex, the
+ * refresh mutex and the class segment mutex to commit the batch. A thread which holds any of these,
+ * or the read mutex, stores directly instead of queueing, so the committing thread never waits for
+ * a queued thread. _writeBatchMutex itself is never held while entering another lock.
+ * Queued threads keep VM access while waiting, as they do while waiting for the write mutex; the
+ * committing thread does not need exclusive VM access to commit the batch.
+ *
+ * @param[in] currentThread  The current thread
+ * @param[in] request  The store to commit. request->result is set if this function returns true.
+ *
+ * @return true if the store was committed by another thread, false if the current thread must store it
+ *
+ * THREADING: This function can be called multi-threaded
+ */
+bool
+SH_CacheMap::joinWriteBatch(J9VMThread* currentThread, WriteBatchRequest* request)
+{
+	bool committed = false;
+
+	if (NULL == _writeBatchMutex) {
+		return false;
+	}
+	/* Don't wait for the committing thread holding a lock it may need to commit the batch */
+	if ((0 != omrthread_monitor_owned_by_self(currentThread->javaVM->classMemorySegments->segmentMutex))
+		|| (0 != omrthread_monitor_owned_by_self(_refreshMutex))
+		|| _ccHead->hasWriteMutex(currentThread)
+		|| _ccHead->hasReadMutex(currentThread)
+	) {
+		return false;
+	}
+
+	request->next = NULL;
+	request->thread = currentThread;
+	request->state = CM_WRITE_BATCH_QUEUED;
+
+	omrthread_monitor_enter(_writeBatchMutex);
+	if (NULL == _writeBatchLeader) {
+		_writeBatchLeader = currentThread;
+	} else {
+		if (NULL == _writeBatchTail) {
+			_writeBatchHead = request;
+		} else {
+			_writeBatchTail->next = request;
+		}
+		_writeBatchTail = request;
+		Trc_SHR_Assert_False(_ccHead->hasWriteMutex(currentThread));
+		while (CM_WRITE_BATCH_QUEUED == request->state) {
+			omrthread_monitor_wait(_writeBatchMutex);
+		}
+		/* CM_WRITE_BATCH_LEAD means the store was handed back to this thread to commit the rest of the batch */
+		committed = (CM_WRITE_BATCH_COMMITTED == request->state);
+	}
+	omrthread_monitor_exit(_writeBatchMutex);
+
+	return committed;
+}
+
+/**
+ * Commit the stores queued by other threads, then pass the batch to the next queued thread, if any.
+ * Does nothing unless the current thread became the committing thread in joinWriteBatch().
+ * At most CM_WRITE_BATCH_MAX_ITEMS stores are committed so that other JVMs are not kept waiting for the write mutex.
+ *
+ * @param[in] currentThread  The current thread
+ * @param[in] hasWriteMutex  true if the current thread holds the write mutex and has passed the entry point checks.
+ * If false, the queued stores are not committed here.
+ *
+ * THREADING: Called with the write mutex held if hasWriteMutex is true
+ */
+void
+SH_CacheMap::commitWriteBatch(J9VMThread* currentThread, bool hasWriteMutex)
+{
+	UDATA committed = 0;
+	J9VMThread* nextLeader = NULL;
+
+	if (NULL == _writeBatchMutex) {
+		return;
+	}
+
+	omrthread_monitor_enter(_writeBatchMutex);
+	if (currentThread != _writeBatchLeader) {
+		omrthread_monitor_exit(_writeBatchMutex);
+		return;
+	}
+	if (hasWriteMutex) {
+		Trc_SHR_Assert_True(_ccHead->hasWriteMutex(currentThread));
+		while ((NULL != _writeBatchHead) && (committed < CM_WRITE_BATCH_MAX_ITEMS)) {
+			WriteBatchRequest* request = _writeBatchHead;
+
+			_writeBatchHead = request->next;
+			if (NULL == _writeBatchHead) {
+				_writeBatchTail = NULL;
+			}
+			omrthread_monitor_exit(_writeBatchMutex);
+
+			if (NULL != request->localRRM) {
+				if (runEntryPointChecks(currentThread, (void*)request->romAddress, request->p_subcstr) == -1) {
+					request->result = (void*)J9SHR_RESOURCE_STORE_ERROR;
+				} else {
+					request->result = storeROMClassResourceLocked(currentThread, request->romAddress, request->localRRM, request->resourceDescriptor, request->forceReplace, request->p_subcstr);
+				}
+			} else {
+				if (runEntryPointChecks(currentThread, NULL, NULL) == -1) {
+					request->result = NULL;
+				} else {
+					request->result = storeSharedDataLocked(currentThread, request->key, request->keylen, request->data, false);
+				}
+			}
+			committed += 1;
+
+			omrthread_monitor_enter(_writeBatchMutex);
+			request->state = CM_WRITE_BATCH_COMMITTED;
+		}
+	}
+	if (NULL != _writeBatchHead) {
+		WriteBatchRequest* request = _writeBatchHead;
+
+		_writeBatchHead = request->next;
+		if (NULL == _writeBatchHead) {
+			_writeBatchTail = NULL;
+		}
+		request->state = CM_WRITE_BATCH_LEAD;
+		nextLeader = request->thread;
+	}
+	_writeBatchLeader = nextLeader;
+	omrthread_monitor_notify_all(_writeBatchMutex);
+	omrthread_monitor_exit(_writeBatchMutex);
+
+	Trc_SHR_CM_commitWriteBatch_Event(currentThread, committed, nextLeader);
+}
+
 /* THREADING: This function can be called multi-threaded */
 const void*
 SH_CacheMap::storeROMClassResource(J9VMThread* currentThread, const void* romAddress, SH_ROMClassResourceManager* localRRM, SH_ROMClassResourceManager::SH_ResourceDescriptor* resourceDescriptor, UDATA forceReplace, const char** p_subcstr)
 {
 	const void* result = NULL;
 	const char* fnName = "storeROMClassResource";
-	const void* resourceWrapper;
-	UDATA resourceKey;
+	WriteBatchRequest request;
 
 	PORT_ACCESS_FROM_VMC(currentThread);
 	Trc_SHR_CM_storeROMClassResource_Entry(currentThread, romAddress, resourceDescriptor, forceReplace);
@@ -2875,30 +3425,71 @@ SH_CacheMap::storeROMClassResource(J9VMThread* currentThread, const void* romAdd
 		return (void*)J9SHR_RESOURCE_STORE_ERROR;
 	}
 
-	if (_ccHead->enterWriteMutex(currentThread, false, fnName) != 0) {
-		if (p_subcstr) {
-			*p_subcstr = j9nls_lookup_message((J9NLS_INFO | J9NLS_DO_NOT_PRINT_MESSAGE_TAG), J9NLS_SHRC_CM_ENTER_WRITE_MUTEX, "enterWriteMutex failed");
+	memset(&request, 0, sizeof(WriteBatchRequest));
+	request.romAddress = romAddress;
+	request.localRRM = localRRM;
+	request.resourceDescriptor = resourceDescriptor;
+	request.forceReplace = forceReplace;
+	request.p_subcstr = p_subcstr;
+	if (joinWriteBatch(currentThread, &request)) {
+		/* Committed by the thread which owned the write mutex */
+		result = request.result;
+	} else {
+		if (_ccHead->enterWriteMutex(currentThread, false, fnName) != 0) {
+			commitWriteBatch(currentThread, false);
+			if (p_subcstr) {
+				*p_subcstr = j9nls_lookup_message((J9NLS_INFO | J9NLS_DO_NOT_PRINT_MESSAGE_TAG), J9NLS_SHRC_CM_ENTER_WRITE_MUTEX, "enterWriteMutex failed");
+			}
+			Trc_SHR_CM_storeROMClassResource_Exit1(currentThread);
+			return (void*)J9SHR_RESOURCE_STORE_ERROR;
 		}
-		Trc_SHR_CM_storeROMClassResource_Exit1(currentThread);
-		return (void*)J9SHR_RESOURCE_STORE_ERROR;
-	}
 
-	if (runEntryPointChecks(currentThread, (void*)romAddress, p_subcstr) == -1) {
+		if (runEntryPointChecks(currentThread, (void*)romAddress, p_subcstr) == -1) {
+			commitWriteBatch(currentThread, false);
+			_ccHead->exitWriteMutex(currentThread, fnName);
+			Trc_SHR_CM_storeROMClassResource_Exit2(currentThread);
+			return (void*)J9SHR_RESOURCE_STORE_ERROR;
+		}
+
+		result = storeROMClassResourceLocked(currentThread, romAddress, localRRM, resourceDescriptor, forceReplace, p_subcstr);
+
+		commitWriteBatch(currentThread, true);
 		_ccHead->exitWriteMutex(currentThread, fnName);
-		Trc_SHR_CM_storeROMClassResource_Exit2(currentThread);
-		return (void*)J9SHR_RESOURCE_STORE_ERROR;
 	}
 
+	if (((void*)J9SHR_RESOURCE_STORE_EXISTS == result) || ((void*)J9SHR_RESOURCE_STORE_INVALIDATED == result)) {
+		Trc_SHR_CM_storeROMClassResource_Exit3(currentThread);
+	} else {
+		Trc_SHR_CM_storeROMClassResource_Exit4(currentThread, result);
+	}
+	return result;
+}
+
+/**
+ * Store a ROMClass resource once the entry point checks have passed.
+ *
+ * @return As for storeROMClassResource()
+ *
+ * THREADING: MUST be protected by cache write mutex - therefore single-threaded within this JVM
+ */
+const void*
+SH_CacheMap::storeROMClassResourceLocked(J9VMThread* currentThread, const void* romAddress, SH_ROMClassResourceManager* localRRM, SH_ROMClassResourceManager::SH_ResourceDescriptor* resourceDescriptor, UDATA forceReplace, const char** p_subcstr)
+{
+	const void* result = NULL;
+	const void* resourceWrapper;
+	UDATA resourceKey;
+
+	PORT_ACCESS_FROM_VMC(currentThread);
+	Trc_SHR_Assert_True(_ccHead->hasWriteMutex(currentThread));
+
 	resourceKey = resourceDescriptor->generateKey(romAddress);
 
 	/* Determine whether the record already exists in the cache */
 	if ((resourceWrapper = (localRRM->findResource(currentThread, resourceKey))) != 0) {
 		if (!forceReplace) {
-			_ccHead->exitWriteMutex(currentThread, fnName);
 			if (p_subcstr) {
 				*p_subcstr = j9nls_lookup_message((J9NLS_INFO | J9NLS_DO_NOT_PRINT_MESSAGE_TAG), J9NLS_SHRC_CM_DATA_EXISTS, "data already exists");
 			}
-			Trc_SHR_CM_storeROMClassResource_Exit3(currentThread);
 			if ((TYPE_INVALIDATED_COMPILED_METHOD == ITEMTYPE(resourceDescriptor->wrapperToItem(resourceWrapper)))) {
 				return (void*)J9SHR_RESOURCE_STORE_INVALIDATED;
 			} else {
@@ -2936,8 +3527,6 @@ SH_CacheMap::storeROMClassResource(J9VMThread* currentThread, const void* romAdd
 #endif /* !defined(J9ZOS390) && !defined(AIXPPC) */
 	}
 
-	_ccHead->exitWriteMutex(currentThread, fnName);
-	Trc_SHR_CM_storeROMClassResource_Exit4(currentThread, result);
 	return result;
 }
 
@@ -3882,17 +4471,10 @@ SH_CacheMap::storeSharedData(J9VMThread* currentThread, const char* key, UDATA k
 {
 	const U_8* result = NULL;
 	const char* fnName = "storeSharedData";
-	ByteDataWrapper* bdwInCache = NULL;
-	UDATA foundDatalen = 0;
-	char utfKey[STACK_STRINGBUF_SIZE];
-	char* utfKeyPtr = (char*)&utfKey;
-	J9UTF8* utfKeyStruct = NULL;
 	UDATA dataNotIndexed = (data != NULL) ? (data->flags & J9SHRDATA_NOT_INDEXED) : 0;
 	SH_ByteDataManager* localBDM;
 	bool overwrite = false;
-	U_32 extraStartupHints = 0;
-
-	PORT_ACCESS_FROM_VMC(currentThread);
+	WriteBatchRequest request;
 
 	Trc_SHR_Assert_True(_sharedClassConfig != NULL);
 
@@ -3914,17 +4496,70 @@ SH_CacheMap::storeSharedData(J9VMThread* currentThread, const char* key, UDATA k
 		}
 	}
 
+	/* An overwrite locks the cache, so it is never committed as part of another thread's batch */
+	if (!overwrite) {
+		memset(&request, 0, sizeof(WriteBatchRequest));
+		request.key = key;
+		request.keylen = keylen;
+		request.data = data;
+		if (joinWriteBatch(currentThread, &request)) {
+			/* Committed by the thread which owned the write mutex */
+			Trc_SHR_CM_storeSharedData_Exit3(currentThread, request.result);
+			return (const U_8*)request.result;
+		}
+	}
+
 	if (_ccHead->enterWriteMutex(currentThread, overwrite, fnName) != 0) {
+		commitWriteBatch(currentThread, false);
 		Trc_SHR_CM_storeSharedData_Exit1(currentThread);
 		return NULL;
 	}
 
 	if (runEntryPointChecks(currentThread, NULL, NULL) == -1) {
+		commitWriteBatch(currentThread, false);
 		_ccHead->exitWriteMutex(currentThread, fnName);
 		Trc_SHR_CM_storeSharedData_Exit2(currentThread);
 		return NULL;
 	}
 
+	result = storeSharedDataLocked(currentThread, key, keylen, data, overwrite);
+
+	commitWriteBatch(currentThread, true);
+	_ccHead->exitWriteMutex(currentThread, fnName);
+
+	Trc_SHR_CM_storeSharedData_Exit3(currentThread, result);
+	return result;
+}
+
+/**
+ * Store shared data once the entry point checks have passed.
+ *
+ * @param[in] currentThread  The current thread
+ * @param[in] key  The UTF8 key to store the data against
+ * @param[in] keylen  The length of the key
+ * @param[in] data  The actual data
+ * @param[in] overwrite  true if the cache was locked to overwrite existing data in place
+ *
+ * @return  The new location of the cached data or null
+ *
+ * THREADING: MUST be protected by cache write mutex - therefore single-threaded within this JVM
+ */
+const U_8*
+SH_CacheMap::storeSharedDataLocked(J9VMThread* currentThread, const char* key, UDATA keylen, const J9SharedDataDescriptor* data, bool overwrite)
+{
+	const U_8* result = NULL;
+	ByteDataWrapper* bdwInCache = NULL;
+	UDATA foundDatalen = 0;
+	char utfKey[STACK_STRINGBUF_SIZE];
+	char* utfKeyPtr = (char*)&utfKey;
+	J9UTF8* utfKeyStruct = NULL;
+	UDATA dataNotIndexed = (data != NULL) ? (data->flags & J9SHRDATA_NOT_INDEXED) : 0;
+	SH_ByteDataManager* localBDM = getByteDataManager(currentThread);
+	U_32 extraStartupHints = 0;
+
+	PORT_ACCESS_FROM_VMC(currentThread);
+	Trc_SHR_Assert_True(_ccHead->hasWriteMutex(currentThread));
+
 	/* Determine whether the record(s) already exist in the cache */
 	if (!dataNotIndexed) {
 		if (data != NULL) {
@@ -4043,9 +4678,6 @@ _done:
 		j9mem_free_memory(utfKeyPtr);
 	}
 
-	_ccHead->exitWriteMutex(currentThread, fnName);
-
-	Trc_SHR_CM_storeSharedData_Exit3(currentThread, result);
 	return result;
 }
 
@@ -4340,7 +4972,14 @@ SH_CacheMap::getJavacoreData(J9JavaVM *vm, J9SharedClassJavacoreDataDescriptor*
 	}
 
 	if (_rcm && (_rcm->getState() == MANAGER_STATE_STARTED)) {
+		UDATA indexedNonStale = 0;
+		UDATA indexedStale = 0;
+
 		_rcm->getNumItems(NULL, &nonstale, &stale);
+		/* ROMClasses found through a lookup index are only in the hashtable once they have been looked up */
+		_rcm->getNumIndexedItems(NULL, &indexedNonStale, &indexedStale);
+		nonstale += indexedNonStale;
+		stale += indexedStale;
 		descriptor->numStaleClasses = stale;
 		descriptor->numROMClasses = stale + nonstale;
 		if (descriptor->numROMClasses > 0) {
@@ -5297,6 +5936,48 @@ SH_CacheMap::printShutdownStats(void)
 	CACHEMAP_TRACE3(J9SHR_VERBOSEFLAG_ENABLE_VERBOSE, J9NLS_INFO, J9NLS_SHRC_CM_PRINTSHUTDOWNSTATS_UNSTORED_V1, softmxUnstoredBytes, maxAOTUnstoredBytes, maxJITUnstoredBytes);
 }
 
+/**
+ * Store a lookup index of the ROMClasses in the top layer, so that JVMs starting later
+ * do not need to add each ROMClass to their hashtable. The index is only rewritten once
+ * enough ROMClasses have been added since the stored index was built.
+ *
+ * @param[in] currentThread  The current thread
+ */
+void
+SH_CacheMap::storeROMClassIndex(J9VMThread* currentThread)
+{
+	const J9SharedROMClassIndex* oldIndex = NULL;
+	J9SharedROMClassIndex* newIndex = NULL;
+	const U_8* indexInCache = NULL;
+	PORT_ACCESS_FROM_PORT(_portlib);
+
+	if ((NULL == currentThread)
+		|| (NULL == _rcm)
+		|| (_rcm->getState() != MANAGER_STATE_STARTED)
+		|| _cc->isRunningReadOnly()
+		|| J9_ARE_ANY_BITS_SET(*_runtimeFlags, J9SHR_RUNTIMEFLAG_DENY_CACHE_UPDATES | J9SHR_RUNTIMEFLAG_BLOCK_SPACE_FULL | J9SHR_RUNTIMEFLAG_AVAILABLE_SPACE_FULL)
+	) {
+		return;
+	}
+
+	oldIndex = _cc->getROMClassIndex();
+	newIndex = _rcm->buildLookupIndex(currentThread, (U_8*)_cc->getCacheHeaderAddress(), _cc->getTotalSize(), oldIndex);
+	if (NULL != newIndex) {
+		J9SharedDataDescriptor descriptor;
+
+		descriptor.address = (U_8*)newIndex;
+		descriptor.length = ROMCLASSINDEXLEN(newIndex->slotCount);
+		descriptor.type = J9SHR_DATA_TYPE_VM;
+		descriptor.flags = 0;
+		indexInCache = storeSharedData(currentThread, J9SHR_ROMCLASS_INDEX_KEY, (UDATA)LITERAL_STRLEN(J9SHR_ROMCLASS_INDEX_KEY), &descriptor);
+		if ((NULL != indexInCache) && _cc->isAddressInMetaDataArea(indexInCache)) {
+			_cc->setROMClassIndex(currentThread, oldIndex, (const J9SharedROMClassIndex*)indexInCache);
+		}
+		Trc_SHR_CM_storeROMClassIndex_Event(currentThread, newIndex->itemCount, indexInCache);
+		j9mem_free_memory(newIndex);
+	}
+}
+
 /**
  * Run required code on JVM exit
  */
@@ -5308,6 +5989,7 @@ SH_CacheMap::runExitCode(J9VMThread* currentThread)
 	SH_CompositeCacheImpl* cache = _ccHead;
 
 	printShutdownStats();
+	storeROMClassIndex(currentThread);
 
 	walkManager = managers()->startDo(currentThread, 0, &state);
 	while (walkManager) {
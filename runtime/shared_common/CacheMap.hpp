@@ -41,6 +41,24 @@
 
 #define CM_CACHE_MAX_METADATA_RELEASES 2
 
+/* Maximum number of stores from other threads committed by the write mutex owner before it releases the mutex */
+#define CM_WRITE_BATCH_MAX_ITEMS 64
+
+/* Limits for storing the items found by a startup readCache() on several threads. A lane holds the items
+ * of one manager, so there are at most as many lanes as managers. */
+#define CM_READ_CACHE_MAX_LANES 8
+#define CM_READ_CACHE_LANE_INITIAL_ITEMS 256
+#define CM_READ_CACHE_PARALLEL_MIN_ITEMS 4096
+#define CM_READ_CACHE_MAX_THREADS 4
+
+/* Percentage of the used bytes of a full cache which must be stale for reclaimStale to replace the cache */
+#define CM_RECLAIM_STALE_PERCENT 50
+
+/* WriteBatchRequest states */
+#define CM_WRITE_BATCH_QUEUED 0
+#define CM_WRITE_BATCH_COMMITTED 1
+#define CM_WRITE_BATCH_LEAD 2
+
 /*
  * The maximum width of the hexadecimal representation of a value of type 'T'.
  */
@@ -284,6 +302,24 @@ public:
 	void setExtraStartupHints(J9VMThread* currentThread);
 
 private:
+	/* A store queued by a thread of this JVM, to be committed by the thread which owns the write mutex */
+	typedef struct WriteBatchRequest {
+		struct WriteBatchRequest* next;
+		J9VMThread* thread;
+		UDATA state;
+		/* storeSharedData */
+		const char* key;
+		UDATA keylen;
+		const J9SharedDataDescriptor* data;
+		/* storeROMClassResource */
+		const void* romAddress;
+		SH_ROMClassResourceManager* localRRM;
+		SH_ROMClassResourceManager::SH_ResourceDescriptor* resourceDescriptor;
+		UDATA forceReplace;
+		const char** p_subcstr;
+		const void* result;
+	} WriteBatchRequest;
+
 	SH_CompositeCacheImpl* _cc;					/* current cache */
 
 	/* See other _writeHash fields below. Put U_64 at the top so the debug
@@ -326,6 +362,12 @@ private:
 	J9Pool* _ccPool;
 	int32_t _metadataReleaseCounter;
 
+	/* Stores waiting for the thread which owns the write mutex; protected by _writeBatchMutex */
+	omrthread_monitor_t _writeBatchMutex;
+	WriteBatchRequest* _writeBatchHead;
+	WriteBatchRequest* _writeBatchTail;
+	J9VMThread* _writeBatchLeader;
+
 	bool _isAssertEnabled; /* flag to turn on/off assertion before acquiring local mutex */
 	
 	SH_Managers * _managers;
@@ -352,6 +394,14 @@ private:
 
 	const void* storeROMClassResource(J9VMThread* currentThread, const void* romAddress, SH_ROMClassResourceManager* localRRM, SH_ROMClassResourceManager::SH_ResourceDescriptor* resourceDescriptor, UDATA forceReplace, const char** p_subcstr);
 
+	const void* storeROMClassResourceLocked(J9VMThread* currentThread, const void* romAddress, SH_ROMClassResourceManager* localRRM, SH_ROMClassResourceManager::SH_ResourceDescriptor* resourceDescriptor, UDATA forceReplace, const char** p_subcstr);
+
+	const U_8* storeSharedDataLocked(J9VMThread* currentThread, const char* key, UDATA keylen, const J9SharedDataDescriptor* data, bool overwrite);
+
+	bool joinWriteBatch(J9VMThread* currentThread, WriteBatchRequest* request);
+
+	void commitWriteBatch(J9VMThread* currentThread, bool hasWriteMutex);
+
 	const void* findROMClassResource(J9VMThread* currentThread, const void* romAddress, SH_ROMClassResourceManager* localRRM, SH_ROMClassResourceManager::SH_ResourceDescriptor* resourceDescriptor, bool useReadMutex, const char** p_subcstr, UDATA* flags);
 
 	UDATA updateROMClassResource(J9VMThread* currentThread, const void* addressInCache, I_32 updateAtOffset, SH_ROMClassResourceManager* localRRM, SH_ROMClassResourceManager::SH_ResourceDescriptor* resourceDescriptor, const J9SharedDataDescriptor* data, bool isUDATA, const char** p_subcstr);
@@ -360,6 +410,8 @@ private:
 
 	void updateROMSegmentList(J9VMThread* currentThread, bool hasClassSegmentMutex, bool topLayerOnly = true);
 
+	void storeROMClassIndex(J9VMThread* currentThread);
+
 	void updateROMSegmentListForCache(J9VMThread* currentThread, SH_CompositeCacheImpl* forCache);
 
 	const char* attachedTypeString(UDATA type);
@@ -444,6 +496,8 @@ private:
 	IDATA storeCacheUniqueID(J9VMThread* currentThread, const char* cacheDir, U_64 createtime, UDATA metadataBytes, UDATA classesBytes, UDATA lineNumTabBytes, UDATA varTabBytes, const char** prereqCacheID, UDATA* idLen);
 
 	void handleStartupError(J9VMThread* currentThread, SH_CompositeCacheImpl* ccToUse, IDATA errorCode, U_64 runtimeFlags, UDATA verboseFlags, bool *doRetry, IDATA *deleteRC);
+
+	bool replaceStaleCache(J9VMThread* currentThread, SH_CompositeCacheImpl* cache);
 	
 	void setCacheAddressRangeArray(void);
 	
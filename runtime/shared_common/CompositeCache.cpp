@@ -37,9 +37,21 @@
 #include "UnitTest.hpp"
 #include "CompositeCacheImpl.hpp"
 
+#if defined(LINUX)
+#include <sys/mman.h>
+#ifndef MADV_POPULATE_READ
+#define MADV_POPULATE_READ 22
+#endif /* MADV_POPULATE_READ */
+#endif /* defined(LINUX) */
+
 #define SEMSUFFIX "SHSEM"
 #define DEFAULT_STARTUPHINTS 64
 
+/* The used areas of the cache are prefaulted in chunks of this size, by up to PREFAULT_MAX_THREADS threads */
+#define PREFAULT_CHUNK_BYTES (4 * 1024 * 1024)
+#define PREFAULT_MAX_THREADS 4
+#define PREFAULT_PAGE_BYTES 4096
+
 /**
  * CACHE AREAS
  *
@@ -1132,6 +1144,9 @@ SH_CompositeCacheImpl::startup(J9VMThread* currentThread, J9SharedClassPreinitCo
 			_theca = (J9SharedCacheHeader*)cacheMemory;
 		} else {
 			_theca = (J9SharedCacheHeader*)_oscache->attach(currentThread, &versionData);
+			if ((0 != _theca) && (NULL != _sharedClassConfig) && J9_ARE_ALL_BITS_SET(_sharedClassConfig->runtimeFlags2, J9SHR_RUNTIMEFLAG2_HUGE_PAGES)) {
+				_oscache->adviseHugePages();
+			}
 
 			/* Verify that a non-realtime VM is not attaching to a Realtime cache when printing stats */
 			if ((_theca != 0) && getContainsCachelets() &&
@@ -3661,6 +3676,65 @@ SH_CompositeCacheImpl::isAddressInMetaDataArea(const void* address) const
 	return ((address >= UPDATEPTR(_theca)) && (address < CADEBUGSTART(_theca)));
 }
 
+/**
+ * Get the prebuilt ROMClass lookup index stored in this cache layer, if there is one.
+ * The index is ignored unless it lies entirely within the metadata area.
+ *
+ * @return the J9SharedROMClassIndex, or NULL if there is no usable index
+ */
+const J9SharedROMClassIndex*
+SH_CompositeCacheImpl::getROMClassIndex(void)
+{
+	const J9SharedROMClassIndex* index = NULL;
+	UDATA indexSRP = 0;
+
+	if (!_started) {
+		Trc_SHR_Assert_ShouldNeverHappen();
+		return NULL;
+	}
+	indexSRP = _theca->romClassIndexSRP;
+	if (0 != indexSRP) {
+		index = (const J9SharedROMClassIndex*)((BlockPtr)_theca + indexSRP);
+		if (!isAddressInMetaDataArea(index)
+			|| (0 == index->slotCount)
+			|| (0 != (index->slotCount & (index->slotCount - 1)))
+			|| !isAddressInMetaDataArea((BlockPtr)index + ROMCLASSINDEXLEN(index->slotCount) - 1)
+		) {
+			index = NULL;
+		}
+	}
+	return index;
+}
+
+/**
+ * Record the prebuilt ROMClass lookup index in the cache header.
+ *
+ * @param [in] currentThread  The current thread
+ * @param [in] oldIndex  The index the caller expects to replace, or NULL
+ * @param [in] newIndex  The new index, which must be in the metadata area of this cache layer
+ *
+ * @return true if the header was updated, false if another JVM replaced oldIndex first
+ */
+bool
+SH_CompositeCacheImpl::setROMClassIndex(J9VMThread* currentThread, const J9SharedROMClassIndex* oldIndex, const J9SharedROMClassIndex* newIndex)
+{
+	UDATA oldSRP = (NULL == oldIndex) ? 0 : (UDATA)((BlockPtr)oldIndex - (BlockPtr)_theca);
+	UDATA newSRP = (UDATA)((BlockPtr)newIndex - (BlockPtr)_theca);
+	UDATA result = 0;
+
+	if (!_started || _readOnlyOSCache || !isAddressInMetaDataArea(newIndex)) {
+		Trc_SHR_Assert_ShouldNeverHappen();
+		return false;
+	}
+
+	unprotectHeaderReadWriteArea(currentThread, false);
+	result = VM_AtomicSupport::lockCompareExchange(&(_theca->romClassIndexSRP), oldSRP, newSRP);
+	protectHeaderReadWriteArea(currentThread, false);
+
+	Trc_SHR_CC_setROMClassIndex_Event(currentThread, newIndex, newIndex->itemCount, result == oldSRP);
+	return (result == oldSRP);
+}
+
 /**
  * Check whether given address is in the Shared Classes cache
  *
@@ -5504,6 +5578,76 @@ SH_CompositeCacheImpl::isCacheMarkedFull(J9VMThread *currentThread)
 	return (J9SHR_ALL_CACHE_FULL_BITS == ((_theca->cacheFullFlags & J9SHR_ALL_CACHE_FULL_BITS)));
 }
 
+/**
+ * Checks if the cache header is marked as having no space left for classes or metadata.
+ * Unlike isCacheMarkedFull(), space reserved for AOT or JIT data may still be available.
+ *
+ * @param [in] currentThread Pointer to J9VMThread structure for the current thread
+ *
+ * @return true if J9SHR_BLOCK_SPACE_FULL or J9SHR_AVAILABLE_SPACE_FULL is set in the cache header, false otherwise
+ *
+ * @pre The caller must hold the shared classes cache write mutex
+ */
+bool
+SH_CompositeCacheImpl::isBlockSpaceMarkedFull(J9VMThread *currentThread)
+{
+	Trc_SHR_Assert_True(hasWriteMutex(currentThread));
+
+	return J9_ARE_ANY_BITS_SET(_theca->cacheFullFlags, J9SHR_BLOCK_SPACE_FULL | J9SHR_AVAILABLE_SPACE_FULL);
+}
+
+/**
+ * Checks if a JVM has started replacing this cache with a new cache of the same name.
+ *
+ * @param [in] currentThread Pointer to J9VMThread structure for the current thread
+ *
+ * @return true if J9SHR_EXTRA_FLAGS_CACHE_REPLACED is set in the cache header, false otherwise
+ *
+ * @pre The caller must hold the shared classes cache write mutex
+ */
+bool
+SH_CompositeCacheImpl::isCacheReplaced(J9VMThread *currentThread)
+{
+	Trc_SHR_Assert_True(hasWriteMutex(currentThread));
+
+	return J9_ARE_ALL_BITS_SET(_theca->extraFlags, J9SHR_EXTRA_FLAGS_CACHE_REPLACED);
+}
+
+/**
+ * Marks the cache as being replaced by a new cache of the same name, so that only one JVM deletes it.
+ *
+ * @param [in] currentThread Pointer to J9VMThread structure for the current thread
+ *
+ * @pre The caller must hold the shared classes cache write mutex
+ */
+void
+SH_CompositeCacheImpl::setCacheReplaced(J9VMThread *currentThread)
+{
+	Trc_SHR_Assert_True(hasWriteMutex(currentThread));
+	setCacheHeaderExtraFlags(currentThread, J9SHR_EXTRA_FLAGS_CACHE_REPLACED);
+}
+
+/**
+ * Removes the mark set by setCacheReplaced(), so that the cache is used again when a JVM fails to delete it.
+ *
+ * @param [in] currentThread Pointer to J9VMThread structure for the current thread
+ *
+ * @pre The caller must hold the shared classes cache write mutex
+ */
+void
+SH_CompositeCacheImpl::clearCacheReplaced(J9VMThread *currentThread)
+{
+	Trc_SHR_Assert_True(hasWriteMutex(currentThread));
+	Trc_SHR_Assert_True(NULL != _theca);
+	if (_started) {
+		unprotectHeaderReadWriteArea(currentThread, false);
+	}
+	_theca->extraFlags &= ~(UDATA)J9SHR_EXTRA_FLAGS_CACHE_REPLACED;
+	if (_started) {
+		protectHeaderReadWriteArea(currentThread, false);
+	}
+}
+
 /**
  * Sets cache full flags in cache header.
  * It should be called when holding the write lock as it sets a field in cache header.
@@ -5751,6 +5895,141 @@ SH_CompositeCacheImpl::dontNeedMetadata(J9VMThread *currentThread)
 		_oscache->dontNeedMetadata(currentThread, (const void *)min, length);
 	}
 }
+
+/* The areas of a cache layer to prefault, each split into PREFAULT_CHUNK_BYTES chunks */
+typedef struct PrefaultWork {
+	omrthread_monitor_t monitor;
+	U_8* metadataStart;
+	U_8* metadataEnd;
+	UDATA metadataChunks;
+	U_8* romClassStart;
+	U_8* romClassEnd;
+	UDATA chunkCount;
+	UDATA nextChunk;
+	UDATA activeThreads;
+} PrefaultWork;
+
+/**
+ * Find the address range of a chunk. The metadata chunks come first, from the end of the metadata area
+ * backwards, since the metadata is walked from the oldest item when the cache is read. The ROMClass
+ * chunks follow in address order.
+ */
+static void
+getPrefaultChunk(PrefaultWork* work, UDATA chunk, U_8** start, U_8** end)
+{
+	if (chunk < work->metadataChunks) {
+		*end = work->metadataEnd - (chunk * PREFAULT_CHUNK_BYTES);
+		*start = ((UDATA)(*end - work->metadataStart) > PREFAULT_CHUNK_BYTES) ? (*end - PREFAULT_CHUNK_BYTES) : work->metadataStart;
+	} else {
+		*start = work->romClassStart + ((chunk - work->metadataChunks) * PREFAULT_CHUNK_BYTES);
+		*end = ((UDATA)(work->romClassEnd - *start) > PREFAULT_CHUNK_BYTES) ? (*start + PREFAULT_CHUNK_BYTES) : work->romClassEnd;
+	}
+}
+
+static void
+prefaultRange(U_8* start, U_8* end)
+{
+	volatile U_8* cursor = (U_8*)((UDATA)start & ~(UDATA)(PREFAULT_PAGE_BYTES - 1));
+
+#if defined(LINUX)
+	/* Populate the page tables without a fault per page where the kernel supports it */
+	if (0 == madvise((void*)cursor, (size_t)(end - (U_8*)cursor), MADV_POPULATE_READ)) {
+		return;
+	}
+#endif /* defined(LINUX) */
+	for (; cursor < end; cursor += PREFAULT_PAGE_BYTES) {
+		(void)*cursor;
+	}
+}
+
+/**
+ * Prefault chunks until none are left.
+ * @param[in] work The prefault work, whose monitor the caller must hold
+ */
+static void
+prefaultChunks(PrefaultWork* work)
+{
+	while (work->nextChunk < work->chunkCount) {
+		U_8* start = NULL;
+		U_8* end = NULL;
+
+		getPrefaultChunk(work, work->nextChunk, &start, &end);
+		work->nextChunk += 1;
+		omrthread_monitor_exit(work->monitor);
+		prefaultRange(start, end);
+		omrthread_monitor_enter(work->monitor);
+	}
+}
+
+static int J9THREAD_PROC
+prefaultWorkerProc(void* entryArg)
+{
+	PrefaultWork* work = (PrefaultWork*)entryArg;
+
+	omrthread_monitor_enter(work->monitor);
+	prefaultChunks(work);
+	work->activeThreads -= 1;
+	omrthread_monitor_notify_all(work->monitor);
+	omrthread_exit(work->monitor);
+
+	/* NO GUARANTEED EXECUTION BEYOND THIS POINT */
+
+	return 0;
+}
+
+/**
+ * Read the used metadata and ROMClass areas of the cache into memory before the cache is read,
+ * so that startup does not take a page fault for each page it touches. The areas are split into
+ * chunks which are prefaulted by several threads.
+ *
+ * @param[in] currentThread The current thread
+ */
+void
+SH_CompositeCacheImpl::prefault(J9VMThread* currentThread)
+{
+	J9JavaVM* vm = currentThread->javaVM;
+	PrefaultWork work;
+	UDATA threadCount = 0;
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	if (!_started) {
+		Trc_SHR_Assert_ShouldNeverHappen();
+		return;
+	}
+
+	memset(&work, 0, sizeof(work));
+	work.metadataStart = (U_8*)UPDATEPTR(_theca);
+	work.metadataEnd = (U_8*)CADEBUGSTART(_theca);
+	work.romClassStart = (U_8*)CASTART(_theca);
+	work.romClassEnd = (U_8*)SEGUPDATEPTR(_theca);
+	work.metadataChunks = ((work.metadataEnd - work.metadataStart) + PREFAULT_CHUNK_BYTES - 1) / PREFAULT_CHUNK_BYTES;
+	work.chunkCount = work.metadataChunks + (((work.romClassEnd - work.romClassStart) + PREFAULT_CHUNK_BYTES - 1) / PREFAULT_CHUNK_BYTES);
+
+	if (work.chunkCount > 1) {
+		threadCount = j9sysinfo_get_number_CPUs_by_type(J9PORT_CPU_TARGET);
+		threadCount = (threadCount > 1) ? (threadCount - 1) : 0;
+		threadCount = OMR_MIN(threadCount, OMR_MIN(work.chunkCount - 1, PREFAULT_MAX_THREADS));
+	}
+	if (0 != omrthread_monitor_init(&work.monitor, 0)) {
+		return;
+	}
+	omrthread_monitor_enter(work.monitor);
+	for (UDATA i = 0; i < threadCount; i++) {
+		if (J9THREAD_SUCCESS != vm->internalVMFunctions->createThreadWithCategory(NULL, vm->defaultOSStackSize, J9THREAD_PRIORITY_NORMAL,
+				0, prefaultWorkerProc, &work, J9THREAD_CATEGORY_SYSTEM_THREAD)
+		) {
+			break;
+		}
+		work.activeThreads += 1;
+	}
+	Trc_SHR_CC_prefault_Event(currentThread, _theca, work.chunkCount, work.activeThreads);
+	prefaultChunks(&work);
+	while (0 != work.activeThreads) {
+		omrthread_monitor_wait(work.monitor);
+	}
+	omrthread_monitor_exit(work.monitor);
+	omrthread_monitor_destroy(work.monitor);
+}
 /**
  * This function changes the permission of the page containing given address by marking the page as read-only or read-write.
  * The address may belong to either segment region, metadata region or class debug data region.
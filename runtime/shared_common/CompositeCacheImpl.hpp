@@ -216,6 +216,10 @@ public:
 
 	bool isAddressInMetaDataArea(const void* address) const;
 
+	const J9SharedROMClassIndex* getROMClassIndex(void);
+
+	bool setROMClassIndex(J9VMThread* currentThread, const J9SharedROMClassIndex* oldIndex, const J9SharedROMClassIndex* newIndex);
+
 	bool isAddressInCache(const void* address, bool includeHeaderReadWriteArea = true);
 
 	void runExitCode(J9VMThread *currentThread);
@@ -332,6 +336,14 @@ public:
 
 	bool isCacheMarkedFull(J9VMThread *currentThread);
 
+	bool isBlockSpaceMarkedFull(J9VMThread *currentThread);
+
+	bool isCacheReplaced(J9VMThread *currentThread);
+
+	void setCacheReplaced(J9VMThread *currentThread);
+
+	void clearCacheReplaced(J9VMThread *currentThread);
+
 	void setCacheHeaderFullFlags(J9VMThread *currentThread, UDATA flags, bool setRuntimeFlags);
 
 	void clearCacheHeaderFullFlags(J9VMThread *currentThread);
@@ -363,6 +375,8 @@ public:
 	IDATA restoreFromSnapshot(J9JavaVM* vm, const char* cacheName, bool* cacheExist);
 	void dontNeedMetadata(J9VMThread *currentThread);
 
+	void prefault(J9VMThread* currentThread);
+
 	void changePartialPageProtection(J9VMThread *currentThread, void *addr, bool readOnly, bool phaseCheck = true);
 
 	void protectPartiallyFilledPages(J9VMThread *currentThread, bool protectSegmentPage = true, bool protectMetadataPage = true, bool protectDebugDataPages = true, bool phaseCheck = true);
@@ -364,16 +364,18 @@ SH_Manager::hllTableAdd(J9VMThread* currentThread, const J9Pool* linkPool, const
 		/* Just to be certain */
 		hashPrimeValue = 0;
 	}
-	if (!(newItem = createLink(key, item, cachelet, hashPrimeValue, linkPool))) {
-		M_ERR_TRACE(J9NLS_SHRC_M_FAILED_CREATE_LINKEDLISTITEM);
-		Trc_SHR_M_hllTableAdd_Exit1(currentThread);
-		return NULL;
-	}
-
 	while (retryCount < MONITOR_ENTER_RETRY_TIMES) {
 		if (_cache->enterLocalMutex(currentThread, _htMutex, "hllTableMutex", "hllTableAdd")==0) {
 			HashLinkedListImpl** rc;
 
+			/* Links are allocated under the hashtable mutex, as a manager may also create links while looking up a key */
+			if (!(newItem = createLink(key, item, cachelet, hashPrimeValue, linkPool))) {
+				_cache->exitLocalMutex(currentThread, _htMutex, "hllTableMutex", "hllTableAdd");
+				M_ERR_TRACE(J9NLS_SHRC_M_FAILED_CREATE_LINKEDLISTITEM);
+				Trc_SHR_M_hllTableAdd_Exit1(currentThread);
+				return NULL;
+			}
+
 			/* This call will not actually add the new item if there is already an entry of the same key in the hashtable. Instead, the value returned
 				by hashTableAdd is passed back as the addToList parameter. The value returned by this function should then be linked to addToList */
 			if ((rc = (HashLinkedListImpl**)hashTableAdd(_hashTable, &newItem))==NULL) {
@@ -210,6 +210,10 @@ protected:
 	static UDATA hllHashFn(void* item, void *userData);
 	static UDATA hllHashEqualFn(void* left, void* right, void *userData);
 
+	HashLinkedListImpl* hllTableLookupHelper(J9VMThread* currentThread, U_8* key, U_16 keySize, UDATA hashValue, SH_CompositeCache* cachelet);
+
+	static UDATA generateHash(J9InternalVMFunctions* internalFunctionTable, U_8* key, U_16 keySize);
+
 private:
 	UDATA _state;
 
@@ -220,11 +224,8 @@ private:
 	void tearDownHashTable(J9VMThread* currentThread);
 
 	HashLinkedListImpl* hllTableAdd(J9VMThread* currentThread, const J9Pool* linkPool, const J9UTF8* key, const ShcItem* item, UDATA hashPrimeValue, SH_CompositeCache* cachelet, HashLinkedListImpl** addToList);
-	HashLinkedListImpl* hllTableLookupHelper(J9VMThread* currentThread, U_8* key, U_16 keySize, UDATA hashValue, SH_CompositeCache* cachelet);
 
 	static UDATA countItemsInList(void* node, void* countData);
-
-	static UDATA generateHash(J9InternalVMFunctions* internalFunctionTable, U_8* key, U_16 keySize);
 };
 
 #endif /* !defined(MANAGER_HPP_INCLUDED) */
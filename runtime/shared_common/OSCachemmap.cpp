@@ -39,6 +39,11 @@
 #include "UnitTest.hpp"
 #include "CacheMap.hpp"
 
+#if defined(LINUX)
+#include <sys/mman.h>
+#include <errno.h>
+#endif /* defined(LINUX) */
+
 #define MMAP_CACHEDATASIZE(size) (size - MMAP_CACHEHEADERSIZE)
 
 #define RETRY_OBTAIN_WRITE_LOCK_SLEEP_NS 100000
@@ -474,6 +479,22 @@ SH_OSCachemmap::dontNeedMetadata(J9VMThread* currentThread, const void* startAdd
 #endif
 }
 
+/**
+ * Advise the OS to back the mapped cache file with transparent huge pages.
+ * This only has an effect where the file system supports huge pages in the page cache.
+ */
+void
+SH_OSCachemmap::adviseHugePages(void)
+{
+#if defined(LINUX)
+	if (NULL != _headerStart) {
+		int rc = madvise(_headerStart, (size_t)_actualFileLength, MADV_HUGEPAGE);
+
+		Trc_SHR_OSC_Mmap_adviseHugePages(_headerStart, _actualFileLength, rc, (0 == rc) ? 0 : errno);
+	}
+#endif /* defined(LINUX) */
+}
+
 /**
  * Destroy a persistent shared classes cache
  *
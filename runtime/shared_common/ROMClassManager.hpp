@@ -51,6 +51,10 @@ struct LocateROMClassResult {
 #define LOCATE_ROMCLASS_RETURN_MARKED_ITEM_STALE 8
 #define LOCATE_ROMCLASS_RETURN_FOUND_SHADOW 16
 
+/* A prebuilt lookup index is only rewritten once at least this many ROMClasses are not covered by it */
+#define ROMCLASS_INDEX_MIN_NEW_ITEMS 256
+#define ROMCLASS_INDEX_MIN_SLOTS 16
+
 /**
  * Sub-interface of SH_Manager used for managing ROMClasses in the cache
  *
@@ -68,6 +72,12 @@ public:
 	virtual const J9ROMClass* findNextExisting(J9VMThread* currentThread, void * &findNextIterator, void * &firstFound, U_16 classnameLength, const char* classnameData) = 0;
 
 	virtual UDATA existsClassForName(J9VMThread* currentThread, const char* path, UDATA pathLen) = 0;
+
+	virtual bool useLookupIndex(J9VMThread* currentThread, const J9SharedROMClassIndex* index, U_8* cacheBase, SH_CompositeCache* cachelet) = 0;
+
+	virtual J9SharedROMClassIndex* buildLookupIndex(J9VMThread* currentThread, U_8* cacheBase, UDATA cacheBytes, const J9SharedROMClassIndex* oldIndex) = 0;
+
+	virtual void getNumIndexedItems(J9VMThread* currentThread, UDATA* nonStaleItems, UDATA* staleItems) = 0;
 	
 };
 
@@ -32,11 +32,13 @@
 #include "ut_j9shr.h"
 #include "j9shrnls.h"
 #include "j9consts.h"
+#include "AtomicSupport.hpp"
 #include <string.h>
 
 SH_ROMClassManagerImpl::SH_ROMClassManagerImpl()
  : _tsm(0),
-   _linkedListImplPool(0)
+   _linkedListImplPool(0),
+   _lookupIndexCount(0)
 {
 }
 
@@ -141,6 +143,8 @@ SH_ROMClassManagerImpl::localTearDownPools(J9VMThread* currentThread)
 		pool_kill(_linkedListImplPool);
 		_linkedListImplPool = NULL;
 	}
+	/* The links created from the lookup indexes have gone with the pool, the cache will be read again in full */
+	_lookupIndexCount = 0;
 
 	Trc_SHR_RMI_localTearDownPools_Exit(currentThread);
 }
@@ -189,6 +193,11 @@ SH_ROMClassManagerImpl::storeNew(J9VMThread* currentThread, const ShcItem* itemI
 		Trc_SHR_RMI_storeNew_Event2(currentThread, J9UTF8_LENGTH(utf8Name), J9UTF8_DATA(utf8Name), romClass);
 	}
 
+	if (0 != _lookupIndexCount) {
+		/* Create the links for this name from the lookup indexes before the new link is added,
+		 * otherwise the existing list would hide the indexed ROMClasses from rcTableLookup() */
+		lookupItemName(currentThread, itemInCache, true);
+	}
 	if (ITEMTYPE(itemInCache) == TYPE_ROMCLASS) {
 		orphanReunited = reuniteOrphan(currentThread, (const char*)J9UTF8_DATA(utf8Name), J9UTF8_LENGTH(utf8Name), itemInCache, romClass);
 	}
@@ -218,7 +227,7 @@ SH_ROMClassManagerImpl::reuniteOrphan(J9VMThread* currentThread, const char* rom
 	}
 	Trc_SHR_RMI_reuniteOrphan_Entry(currentThread, nameLen, romClassName);
 
-	found = hllTableLookup(currentThread, romClassName, (U_16)nameLen, false);
+	found = rcTableLookup(currentThread, romClassName, (U_16)nameLen);
 	walk = found;
 
 	if (!found) {
@@ -276,7 +285,7 @@ SH_ROMClassManagerImpl::findNextExisting(J9VMThread* currentThread, void * &find
 
 	if (findNextIterator == NULL) {
 		Trc_SHR_RMI_findNextROMClass_FirstElem_Event(currentThread);
-		walk = hllTableLookup(currentThread, classnameData, classnameLength, true);
+		walk = rcTableLookup(currentThread, classnameData, classnameLength);
 		firstFound = (void *)walk;
 		findNextIterator = (void *)walk;
 	} else {
@@ -338,7 +347,7 @@ SH_ROMClassManagerImpl::findNextExisting(J9VMThread* currentThread, void * &find
 UDATA
 SH_ROMClassManagerImpl::existsClassForName(J9VMThread* currentThread, const char* path, UDATA pathLen)
 {
-	return (hllTableLookup(currentThread, path, (U_16)pathLen, true) != NULL);	
+	return (rcTableLookup(currentThread, path, (U_16)pathLen) != NULL);	
 }
 
 
@@ -399,7 +408,7 @@ SH_ROMClassManagerImpl::locateROMClass(J9VMThread* currentThread, const char* pa
 	result->foundAtIndex = -1;
 	result->staleCPEI = NULL;
 
-	found = hllTableLookup(currentThread, path, (U_16)pathLen, true);
+	found = rcTableLookup(currentThread, path, (U_16)pathLen);
 
 	if (!found) {
 		/*** NOTHING IS FOUND, TELL THE CALLER THAT IT MIGHT BE WORTH WAITING ***/
@@ -621,3 +630,370 @@ SH_ROMClassManagerImpl::customCountItemsInList(void* entry, void* opaque)
 	} while (node != walk);
 	return 0;
 }
+
+/**
+ * Returns the name of the ROMClass referenced by a ROMClass, scoped ROMClass or orphan item
+ */
+const J9UTF8*
+SH_ROMClassManagerImpl::getClassNameForItem(const ShcItem* item)
+{
+	J9ROMClass* romClass = NULL;
+
+	if (TYPE_ORPHAN == ITEMTYPE(item)) {
+		romClass = (J9ROMClass*)_cache->getAddressFromJ9ShrOffset(&(((OrphanWrapper*)ITEMDATA(item))->romClassOffset));
+	} else {
+		romClass = (J9ROMClass*)_cache->getAddressFromJ9ShrOffset(&(((ROMClassWrapper*)ITEMDATA(item))->romClassOffset));
+	}
+	return J9ROMCLASS_CLASSNAME(romClass);
+}
+
+/**
+ * Look up the list for the class name of an item, using the same key as a link created for the item.
+ *
+ * @param[in] currentThread The current thread
+ * @param[in] item A ROMClass, scoped ROMClass or orphan item
+ * @param[in] createIndexedLinks If true, the links for the name are created from the lookup indexes if needed.
+ * If false, the caller must hold the hashtable mutex.
+ *
+ * @return The list for the name, or NULL if there is none
+ */
+SH_Manager::HashLinkedListImpl*
+SH_ROMClassManagerImpl::lookupItemName(J9VMThread* currentThread, const ShcItem* item, bool createIndexedLinks)
+{
+	HashLinkedListImpl key;
+
+	key.initialize(getClassNameForItem(item), item, NULL, 0);
+	if (createIndexedLinks) {
+		return rcTableLookup(currentThread, (const char*)key._key, key._keySize);
+	}
+	return hllTableLookupHelper(currentThread, key._key, key._keySize, 0, NULL);
+}
+
+/**
+ * Look up the list for a class name. If the name is not in the hashtable, its links are created
+ * from the lookup indexes, in the order of the indexes.
+ *
+ * @param[in] currentThread The current thread
+ * @param[in] name The class name
+ * @param[in] nameLen The length of name
+ *
+ * @return The list for the name, or NULL if there is none
+ */
+SH_Manager::HashLinkedListImpl*
+SH_ROMClassManagerImpl::rcTableLookup(J9VMThread* currentThread, const char* name, U_16 nameLen)
+{
+	HashLinkedListImpl* result = hllTableLookup(currentThread, name, nameLen, true);
+
+	if ((NULL == result) && (0 != _lookupIndexCount)) {
+		if (lockHashTable(currentThread, "rcTableLookup")) {
+			/* Another thread may have created the links since the lookup */
+			result = hllTableLookupHelper(currentThread, (U_8*)name, nameLen, 0, NULL);
+			if (NULL == result) {
+				UDATA hash = generateHash(currentThread->javaVM->internalVMFunctions, (U_8*)name, nameLen);
+
+				for (UDATA i = 0; i < _lookupIndexCount; i++) {
+					result = addIndexedLinks(currentThread, &_lookupIndexes[i], name, nameLen, hash, result);
+				}
+				if ((NULL != result) && (NULL == hashTableAdd(_hashTable, &result))) {
+					/* The links are freed with the pool */
+					result = NULL;
+				}
+				Trc_SHR_RMI_rcTableLookup_CreatedIndexedLinks(currentThread, nameLen, name, result);
+			}
+			unlockHashTable(currentThread, "rcTableLookup");
+		}
+	}
+	return result;
+}
+
+/**
+ * Append links for the ROMClasses named name in a lookup index to a list.
+ *
+ * THREADING: The caller must hold the hashtable mutex
+ *
+ * @param[in] currentThread The current thread
+ * @param[in] lookupIndex The lookup index to search
+ * @param[in] name The class name
+ * @param[in] nameLen The length of name
+ * @param[in] hash The hash of name
+ * @param[in] head The list to append to, or NULL
+ *
+ * @return The head of the list, or NULL if it is still empty
+ */
+SH_Manager::HashLinkedListImpl*
+SH_ROMClassManagerImpl::addIndexedLinks(J9VMThread* currentThread, const LookupIndex* lookupIndex, const char* name, U_16 nameLen, UDATA hash, HashLinkedListImpl* head)
+{
+	const J9SharedROMClassIndex* index = lookupIndex->index;
+	const J9SharedROMClassIndexSlot* slots = ROMCLASSINDEXSLOTS(index);
+	U_32 mask = index->slotCount - 1;
+	U_32 slot = (U_32)hash & mask;
+	HashLinkedListImpl* tail = head;
+
+	if (NULL != tail) {
+		while (head != tail->_next) {
+			tail = (HashLinkedListImpl*)tail->_next;
+		}
+	}
+	while (0 != slots[slot].itemOffset) {
+		if ((U_32)hash == slots[slot].hash) {
+			const ShcItem* item = (const ShcItem*)(lookupIndex->cacheBase + slots[slot].itemOffset);
+			HashLinkedListImpl* link = createLink(getClassNameForItem(item), item, lookupIndex->cachelet, 0, _linkedListImplPool);
+
+			if (NULL == link) {
+				PORT_ACCESS_FROM_PORT(_portlib);
+				M_ERR_TRACE(J9NLS_SHRC_M_FAILED_CREATE_LINKEDLISTITEM);
+				break;
+			}
+			if ((nameLen == link->_keySize) && (0 == memcmp(link->_key, name, nameLen))) {
+				if (NULL == head) {
+					head = link;
+				} else {
+					link->_next = head;
+					tail->_next = link;
+				}
+				tail = link;
+			} else {
+				pool_removeElement(_linkedListImplPool, link);
+			}
+		}
+		slot = (slot + 1) & mask;
+	}
+	return head;
+}
+
+/**
+ * Use a lookup index stored in a cache layer. The caller does not pass the ROMClasses covered by the index
+ * to storeNew() when the layer is read. Their links are created the first time their name is looked up.
+ *
+ * THREADING: Called while the cache is read at startup
+ *
+ * @see ROMClassManager.hpp
+ * @param[in] currentThread The current thread
+ * @param[in] index The lookup index in the cache
+ * @param[in] cacheBase The address the offsets in the index are relative to
+ * @param[in] cachelet The cache layer containing the index
+ *
+ * @return true if the index is used, false if the caller must store every ROMClass in the layer
+ */
+bool
+SH_ROMClassManagerImpl::useLookupIndex(J9VMThread* currentThread, const J9SharedROMClassIndex* index, U_8* cacheBase, SH_CompositeCache* cachelet)
+{
+	bool result = false;
+
+	if ((getState() != MANAGER_STATE_STARTED) || (_lookupIndexCount > J9SH_LAYER_NUM_MAX_VALUE)) {
+		return false;
+	}
+	if (lockHashTable(currentThread, "useLookupIndex")) {
+		LookupIndex* lookupIndex = &_lookupIndexes[_lookupIndexCount];
+
+		for (UDATA i = 0; i < _lookupIndexCount; i++) {
+			if (index == _lookupIndexes[i].index) {
+				unlockHashTable(currentThread, "useLookupIndex");
+				return true;
+			}
+		}
+		lookupIndex->index = index;
+		lookupIndex->cacheBase = cacheBase;
+		lookupIndex->cachelet = cachelet;
+
+		if (0 != hashTableGetCount(_hashTable)) {
+			/* Names read from other layers already have lists, which rcTableLookup() will not extend.
+			 * Append the ROMClasses in this index to them now. */
+			const J9SharedROMClassIndexSlot* slots = ROMCLASSINDEXSLOTS(index);
+
+			for (U_32 slot = 0; slot < index->slotCount; slot++) {
+				if (0 != slots[slot].itemOffset) {
+					const ShcItem* item = (const ShcItem*)(cacheBase + slots[slot].itemOffset);
+					HashLinkedListImpl* head = lookupItemName(currentThread, item, false);
+
+					if (NULL != head) {
+						HashLinkedListImpl* link = createLink(getClassNameForItem(item), item, cachelet, 0, _linkedListImplPool);
+						HashLinkedListImpl* tail = head;
+
+						if (NULL == link) {
+							PORT_ACCESS_FROM_PORT(_portlib);
+							M_ERR_TRACE(J9NLS_SHRC_M_FAILED_CREATE_LINKEDLISTITEM);
+							unlockHashTable(currentThread, "useLookupIndex");
+							return false;
+						}
+						while (head != tail->_next) {
+							tail = (HashLinkedListImpl*)tail->_next;
+						}
+						link->_next = head;
+						tail->_next = link;
+					}
+				}
+			}
+		}
+		/* rcTableLookup() reads _lookupIndexCount without the hashtable mutex */
+		VM_AtomicSupport::writeBarrier();
+		_lookupIndexCount += 1;
+		result = true;
+		Trc_SHR_RMI_useLookupIndex_Event(currentThread, index, index->itemCount, cachelet);
+		unlockHashTable(currentThread, "useLookupIndex");
+	}
+	return result;
+}
+
+/**
+ * Insert an item into a lookup index using linear probing
+ */
+static void
+addToLookupIndex(J9SharedROMClassIndex* index, U_32 hash, U_32 itemOffset)
+{
+	J9SharedROMClassIndexSlot* slots = ROMCLASSINDEXSLOTS(index);
+	U_32 mask = index->slotCount - 1;
+	U_32 slot = hash & mask;
+
+	while (0 != slots[slot].itemOffset) {
+		slot = (slot + 1) & mask;
+	}
+	slots[slot].hash = hash;
+	slots[slot].itemOffset = itemOffset;
+	index->itemCount += 1;
+	if (itemOffset < index->coveredOffset) {
+		index->coveredOffset = itemOffset;
+	}
+}
+
+/**
+ * Build a lookup index of the ROMClasses known to this JVM which are stored in one cache layer.
+ *
+ * @see ROMClassManager.hpp
+ * @param[in] currentThread The current thread
+ * @param[in] cacheBase The start of the layer. The offsets in the index are relative to it.
+ * @param[in] cacheBytes The size of the layer
+ * @param[in] oldIndex The index currently stored in the layer, or NULL
+ *
+ * @return A new index allocated with j9mem_allocate_memory(), or NULL if no new index should be stored
+ */
+J9SharedROMClassIndex*
+SH_ROMClassManagerImpl::buildLookupIndex(J9VMThread* currentThread, U_8* cacheBase, UDATA cacheBytes, const J9SharedROMClassIndex* oldIndex)
+{
+	J9SharedROMClassIndex* index = NULL;
+	U_8* cacheEnd = cacheBase + cacheBytes;
+	U_8* coveredStart = (NULL == oldIndex) ? cacheEnd : (cacheBase + oldIndex->coveredOffset);
+	UDATA itemCount = 0;
+	UDATA newItemCount = 0;
+	PORT_ACCESS_FROM_PORT(_portlib);
+
+	if (getState() != MANAGER_STATE_STARTED) {
+		return NULL;
+	}
+	if (!lockHashTable(currentThread, "buildLookupIndex")) {
+		return NULL;
+	}
+
+	/* Pass 0 counts the items, pass 1 fills the index. An item is either in a list in the hashtable
+	 * or, if its name has not been looked up, in a lookup index used by this JVM. */
+	for (UDATA pass = 0; pass < 2; pass++) {
+		J9HashTableState state;
+		HashLinkedListImpl** node = (HashLinkedListImpl**)hashTableStartDo(_hashTable, &state);
+
+		while (NULL != node) {
+			HashLinkedListImpl* walk = *node;
+
+			do {
+				U_8* item = (U_8*)walk->_item;
+
+				if ((item >= cacheBase) && (item < cacheEnd)) {
+					if (0 == pass) {
+						itemCount += 1;
+						newItemCount += (item < coveredStart) ? 1 : 0;
+					} else {
+						addToLookupIndex(index, (U_32)generateHash(currentThread->javaVM->internalVMFunctions, walk->_key, walk->_keySize), (U_32)(item - cacheBase));
+					}
+				}
+				walk = (HashLinkedListImpl*)walk->_next;
+			} while (*node != walk);
+			node = (HashLinkedListImpl**)hashTableNextDo(&state);
+		}
+		for (UDATA i = 0; i < _lookupIndexCount; i++) {
+			const J9SharedROMClassIndex* usedIndex = _lookupIndexes[i].index;
+			const J9SharedROMClassIndexSlot* slots = ROMCLASSINDEXSLOTS(usedIndex);
+
+			if (cacheBase != _lookupIndexes[i].cacheBase) {
+				continue;
+			}
+			for (U_32 slot = 0; slot < usedIndex->slotCount; slot++) {
+				if ((0 != slots[slot].itemOffset)
+					&& (NULL == lookupItemName(currentThread, (const ShcItem*)(cacheBase + slots[slot].itemOffset), false))
+				) {
+					if (0 == pass) {
+						itemCount += 1;
+						newItemCount += ((cacheBase + slots[slot].itemOffset) < coveredStart) ? 1 : 0;
+					} else {
+						addToLookupIndex(index, slots[slot].hash, slots[slot].itemOffset);
+					}
+				}
+			}
+		}
+
+		if (0 == pass) {
+			U_32 slotCount = ROMCLASS_INDEX_MIN_SLOTS;
+
+			/* Only replace the stored index if enough ROMClasses are missing from it */
+			if ((newItemCount < ROMCLASS_INDEX_MIN_NEW_ITEMS)
+				|| ((NULL != oldIndex) && (newItemCount < oldIndex->itemCount))
+				|| (cacheBytes != (U_32)cacheBytes)
+			) {
+				break;
+			}
+			while (slotCount < (itemCount * 2)) {
+				slotCount <<= 1;
+			}
+			index = (J9SharedROMClassIndex*)j9mem_allocate_memory(ROMCLASSINDEXLEN(slotCount), J9MEM_CATEGORY_CLASSES);
+			if (NULL == index) {
+				M_ERR_TRACE(J9NLS_SHRC_RMI_FAILED_CREATE_POOL);
+				break;
+			}
+			memset(index, 0, ROMCLASSINDEXLEN(slotCount));
+			index->slotCount = slotCount;
+			index->coveredOffset = (U_32)cacheBytes;
+		}
+	}
+	unlockHashTable(currentThread, "buildLookupIndex");
+
+	Trc_SHR_RMI_buildLookupIndex_Event(currentThread, itemCount, newItemCount, index);
+	return index;
+}
+
+/**
+ * Count the ROMClasses in the lookup indexes whose links have not been created yet.
+ * These are not included in the counts from getNumItems().
+ *
+ * @see ROMClassManager.hpp
+ * @param[in] currentThread The current thread, may be NULL
+ * @param[out] nonStaleItems The number of non-stale ROMClasses
+ * @param[out] staleItems The number of stale ROMClasses
+ */
+void
+SH_ROMClassManagerImpl::getNumIndexedItems(J9VMThread* currentThread, UDATA* nonStaleItems, UDATA* staleItems)
+{
+	*nonStaleItems = 0;
+	*staleItems = 0;
+
+	if ((getState() != MANAGER_STATE_STARTED) || (0 == _lookupIndexCount)) {
+		return;
+	}
+	if (lockHashTable(currentThread, "getNumIndexedItems")) {
+		for (UDATA i = 0; i < _lookupIndexCount; i++) {
+			const J9SharedROMClassIndexSlot* slots = ROMCLASSINDEXSLOTS(_lookupIndexes[i].index);
+
+			for (U_32 slot = 0; slot < _lookupIndexes[i].index->slotCount; slot++) {
+				if (0 != slots[slot].itemOffset) {
+					const ShcItem* item = (const ShcItem*)(_lookupIndexes[i].cacheBase + slots[slot].itemOffset);
+
+					if (NULL == lookupItemName(currentThread, item, false)) {
+						if (_cache->isStale(item)) {
+							*staleItems += 1;
+						} else {
+							*nonStaleItems += 1;
+						}
+					}
+				}
+			}
+		}
+		unlockHashTable(currentThread, "getNumIndexedItems");
+	}
+}
@@ -33,6 +33,7 @@
 #include "TimestampManager.hpp"
 #include "j9.h"
 #include "j9protos.h"
+#include "shchelp.h" /* J9SH_LAYER_NUM_MAX_VALUE */
 
 /**
  * Implementation of SH_ROMClassManager
@@ -67,6 +68,12 @@ public:
 
 	virtual UDATA existsClassForName(J9VMThread* currentThread, const char* path, UDATA pathLen);
 
+	virtual bool useLookupIndex(J9VMThread* currentThread, const J9SharedROMClassIndex* index, U_8* cacheBase, SH_CompositeCache* cachelet);
+
+	virtual J9SharedROMClassIndex* buildLookupIndex(J9VMThread* currentThread, U_8* cacheBase, UDATA cacheBytes, const J9SharedROMClassIndex* oldIndex);
+
+	virtual void getNumIndexedItems(J9VMThread* currentThread, UDATA* nonStaleItems, UDATA* staleItems);
+
 	void runExitCode(void) {};	
 
 protected:
@@ -105,6 +112,27 @@ private:
 	 */
 	J9Pool* _linkedListImplPool;
 
+	/**
+	 * Prebuilt lookup indexes found in the cache layers at startup.
+	 * ROMClasses in an index are not added to _hashTable when the cache is read. Instead, the links for a class name
+	 * are created from the index the first time the name is looked up.
+	 */
+	struct LookupIndex {
+		const J9SharedROMClassIndex* index;
+		U_8* cacheBase;
+		SH_CompositeCache* cachelet;
+	};
+	LookupIndex _lookupIndexes[J9SH_LAYER_NUM_MAX_VALUE + 1];
+	UDATA _lookupIndexCount;
+
+	HashLinkedListImpl* rcTableLookup(J9VMThread* currentThread, const char* name, U_16 nameLen);
+
+	HashLinkedListImpl* addIndexedLinks(J9VMThread* currentThread, const LookupIndex* lookupIndex, const char* name, U_16 nameLen, UDATA hash, HashLinkedListImpl* head);
+
+	HashLinkedListImpl* lookupItemName(J9VMThread* currentThread, const ShcItem* item, bool createIndexedLinks);
+
+	const J9UTF8* getClassNameForItem(const ShcItem* item);
+
 
 	bool checkTimestamp(J9VMThread* currentThread, const char* path, UDATA pathLen, ROMClassWrapper* wrapper, const ShcItem* item);
 
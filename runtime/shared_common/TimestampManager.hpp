@@ -73,6 +73,11 @@ public:
 	 * 					(Contains the current timestamp)
 	 */
 	virtual I_64 checkROMClassTimeStamp(J9VMThread* currentThread, const char* className, UDATA classNameLen, ClasspathEntryItem* cpei, ROMClassWrapper* rcWrapper) = 0;
+
+	/*
+	 * Frees any resources held by the timestamp manager.
+	 */
+	virtual void cleanup(J9VMThread* currentThread) = 0;
 protected:
 	/* - Virtual destructor has been added to avoid compile warnings. 
 	 * - Delete operator added to avoid linkage with C++ runtime libs 
@@ -32,6 +32,26 @@ SH_TimestampManagerImpl::newInstance(J9JavaVM* vm, SH_TimestampManagerImpl* memF
 
 	new(newTSM) SH_TimestampManagerImpl();
 	newTSM->_sharedClassConfig = sharedClassConfig;
+	newTSM->_lastModTable = NULL;
+	newTSM->_lastModMutex = NULL;
+	newTSM->_checkIntervalNanos = 0;
+
+	if ((NULL != vm->sharedCacheAPI) && (0 != vm->sharedCacheAPI->timestampCheckInterval)) {
+		PORT_ACCESS_FROM_JAVAVM(vm);
+
+		/* If the table cannot be created, every check goes to the file system */
+		if (0 == omrthread_monitor_init_with_name(&newTSM->_lastModMutex, 0, "Shared class timestamp table mutex")) {
+			newTSM->_lastModTable = hashTableNew(OMRPORT_FROM_J9PORT(PORTLIB), J9_GET_CALLSITE(), 0, sizeof(LastModifiedEntry), sizeof(char *), 0, J9MEM_CATEGORY_CLASSES, lastModHashFn, lastModHashEqualFn, NULL, (void*)vm->internalVMFunctions);
+			if (NULL == newTSM->_lastModTable) {
+				omrthread_monitor_destroy(newTSM->_lastModMutex);
+				newTSM->_lastModMutex = NULL;
+			} else {
+				newTSM->_checkIntervalNanos = (I_64)vm->sharedCacheAPI->timestampCheckInterval * 1000000;
+			}
+		} else {
+			newTSM->_lastModMutex = NULL;
+		}
+	}
 
 	return newTSM;
 }
@@ -85,7 +105,7 @@ SH_TimestampManagerImpl::localCheckTimeStamp(J9VMThread* currentThread, Classpat
 	if (!pathBufPtr) {
 		return TIMESTAMP_DOES_NOT_EXIST;
 	}
-	current = j9file_lastmod(pathBufPtr);
+	current = getLastModified(currentThread, pathBufPtr);
 	if (doFreeBuffer) {
 		j9mem_free_memory(pathBufPtr);
 	}
@@ -105,4 +125,100 @@ SH_TimestampManagerImpl::localCheckTimeStamp(J9VMThread* currentThread, Classpat
 	}
 }
 
+void
+SH_TimestampManagerImpl::cleanup(J9VMThread* currentThread)
+{
+	if (NULL != _lastModTable) {
+		hashTableForEachDo(_lastModTable, lastModFreeFn, currentThread->javaVM->portLibrary);
+		hashTableFree(_lastModTable);
+		_lastModTable = NULL;
+	}
+	if (NULL != _lastModMutex) {
+		omrthread_monitor_destroy(_lastModMutex);
+		_lastModMutex = NULL;
+	}
+}
+
+/* Returns the last modified time of path, or -1 if it does not exist.
+ * When timestampCheckInterval= is set, the file system is asked at most once per interval for each path,
+ * so repeated lookups of classes from the same container do not each stat the container. */
+I_64
+SH_TimestampManagerImpl::getLastModified(J9VMThread* currentThread, const char* path)
+{
+	LastModifiedEntry query;
+	LastModifiedEntry* entry = NULL;
+	I_64 now = 0;
+	I_64 result = 0;
+
+	PORT_ACCESS_FROM_PORT(currentThread->javaVM->portLibrary);
+
+	if (NULL == _lastModTable) {
+		return j9file_lastmod(path);
+	}
+
+	query.path = (char*)path;
+	query.pathLen = strlen(path);
+	now = j9time_nano_time();
+
+	omrthread_monitor_enter(_lastModMutex);
+	entry = (LastModifiedEntry*)hashTableFind(_lastModTable, &query);
+	if ((NULL != entry) && ((now - entry->checkedNanos) < _checkIntervalNanos)) {
+		result = entry->lastModified;
+		omrthread_monitor_exit(_lastModMutex);
+		Trc_SHR_TMI_getLastModified_Remembered(currentThread, path, result);
+		return result;
+	}
+	omrthread_monitor_exit(_lastModMutex);
+
+	/* Do not hold the mutex across the file system call */
+	result = j9file_lastmod(path);
+
+	omrthread_monitor_enter(_lastModMutex);
+	entry = (LastModifiedEntry*)hashTableFind(_lastModTable, &query);
+	if (NULL != entry) {
+		entry->lastModified = result;
+		entry->checkedNanos = now;
+	} else if (hashTableGetCount(_lastModTable) < TSM_LASTMOD_TABLE_MAX_ENTRIES) {
+		char* pathCopy = (char*)j9mem_allocate_memory(query.pathLen + 1, J9MEM_CATEGORY_CLASSES);
 
+		if (NULL != pathCopy) {
+			memcpy(pathCopy, path, query.pathLen + 1);
+			query.path = pathCopy;
+			query.lastModified = result;
+			query.checkedNanos = now;
+			if (NULL == hashTableAdd(_lastModTable, &query)) {
+				j9mem_free_memory(pathCopy);
+			}
+		}
+	}
+	omrthread_monitor_exit(_lastModMutex);
+
+	return result;
+}
+
+UDATA
+SH_TimestampManagerImpl::lastModHashFn(void* item, void* userData)
+{
+	LastModifiedEntry* entry = (LastModifiedEntry*)item;
+	J9InternalVMFunctions* internalFunctionTable = (J9InternalVMFunctions*)userData;
+
+	return internalFunctionTable->computeHashForUTF8((U_8*)entry->path, entry->pathLen);
+}
+
+UDATA
+SH_TimestampManagerImpl::lastModHashEqualFn(void* left, void* right, void* userData)
+{
+	LastModifiedEntry* leftEntry = (LastModifiedEntry*)left;
+	LastModifiedEntry* rightEntry = (LastModifiedEntry*)right;
+
+	return ((leftEntry->pathLen == rightEntry->pathLen) && (0 == memcmp(leftEntry->path, rightEntry->path, leftEntry->pathLen)));
+}
+
+UDATA
+SH_TimestampManagerImpl::lastModFreeFn(void* entry, void* userData)
+{
+	PORT_ACCESS_FROM_PORT((J9PortLibrary*)userData);
+
+	j9mem_free_memory(((LastModifiedEntry*)entry)->path);
+	return FALSE;
+}
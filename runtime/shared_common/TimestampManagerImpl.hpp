@@ -26,6 +26,10 @@
 /* @ddr_namespace: default */
 #include "TimestampManager.hpp"
 #include "Managers.hpp"
+#include "hashtable_api.h"
+
+/* Upper bound on the number of paths whose last modified time is remembered */
+#define TSM_LASTMOD_TABLE_MAX_ENTRIES 65536
 
 /* 
  * Implementation of SH_TimestampManager interface
@@ -56,10 +60,30 @@ public:
 	/* @see TimestampManager.hpp */
 	virtual I_64 checkROMClassTimeStamp(J9VMThread* currentThread, const char* className, UDATA classNameLen, ClasspathEntryItem* cpei, ROMClassWrapper* rcWrapper);
 
+	/* @see TimestampManager.hpp */
+	virtual void cleanup(J9VMThread* currentThread);
+
 private:
+	/* The last modified time of a path, as returned by j9file_lastmod() */
+	typedef struct LastModifiedEntry {
+		char* path;
+		UDATA pathLen;
+		I_64 lastModified;
+		I_64 checkedNanos;
+	} LastModifiedEntry;
+
+	static UDATA lastModHashFn(void* item, void* userData);
+	static UDATA lastModHashEqualFn(void* left, void* right, void* userData);
+	static UDATA lastModFreeFn(void* entry, void* userData);
+
+	I_64 getLastModified(J9VMThread* currentThread, const char* path);
 
 	I_64 localCheckTimeStamp(J9VMThread* currentThread, ClasspathEntryItem* cpei, const char* className, UDATA classNameLen, ROMClassWrapper* rcWrapper);
 	J9SharedClassConfig* _sharedClassConfig;
+	/* Remembers the last modified time of each path checked within the last _checkIntervalNanos; NULL if disabled */
+	J9HashTable* _lastModTable;
+	omrthread_monitor_t _lastModMutex;
+	I_64 _checkIntervalNanos;
 };
 
 #endif /* !defined(TIMESTAMPMANAGERIMPL_HPP_INCLUDED) */
@@ -240,6 +240,10 @@ J9SharedClassesHelpText J9SHAREDCLASSESHELPTEXT[] = {
 	{OPTION_RESTRICT_CLASSPATHS, J9NLS_SHRC_SHRINIT_HELPTEXT_RESTRICT_CLASSPATHS, 0, 0},
 	{OPTION_ALLOW_CLASSPATHS, J9NLS_SHRC_SHRINIT_HELPTEXT_ALLOW_CLASSPATHS, 0, 0},
 	{OPTION_NO_PERSISTENT_DISK_SPACE_CHECK, J9NLS_SHRC_SHRINIT_HELPTEXT_NO_PERSISTENT_DISK_SPACE_CHECK, 0, 0},
+	{OPTION_HUGE_PAGES, J9NLS_SHRC_SHRINIT_HELPTEXT_HUGE_PAGES, 0, 0},
+	{OPTION_PREFAULT, J9NLS_SHRC_SHRINIT_HELPTEXT_PREFAULT, 0, 0},
+	{OPTION_RECLAIM_STALE, J9NLS_SHRC_SHRINIT_HELPTEXT_RECLAIM_STALE, 0, 0},
+	{HELPTEXT_OPTION_TIMESTAMP_CHECK_INTERVAL_EQUALS, J9NLS_SHRC_SHRINIT_HELPTEXT_TIMESTAMP_CHECK_INTERVAL_EQUALS, 0, 0},
 	HELPTEXT_NEWLINE,
 	{HELPTEXT_INVALIDATE_AOT_METHODS_OPTION, J9NLS_SHRC_SHRINIT_HELPTEXT_INVALIDATE_AOT_METHODS, 0, 0},
 	{HELPTEXT_REVALIDATE_AOT_METHODS_OPTION, J9NLS_SHRC_SHRINIT_HELPTEXT_REVALIDATE_AOT_METHODS, 0, 0},
@@ -388,6 +392,10 @@ J9SharedClassesOptions J9SHAREDCLASSESOPTIONS[] = {
 	{ OPTION_TEST_HALF_PAGESIZE, PARSE_TYPE_EXACT, RESULT_DO_ADD_RUNTIMEFLAG2, J9SHR_RUNTIMEFLAG2_TEST_HALF_PAGESIZE},
 	{ OPTION_EXTRA_STARTUPHINTS_EQUALS, PARSE_TYPE_STARTSWITH, RESULT_DO_SET_EXTRA_STARTUPHINTS, 0},
 	{ OPTION_SHARE_LAMBDAFORM, PARSE_TYPE_EXACT, RESULT_DO_ADD_RUNTIMEFLAG2, J9SHR_RUNTIMEFLAG2_SHARE_LAMBDAFORM},
+	{ OPTION_HUGE_PAGES, PARSE_TYPE_EXACT, RESULT_DO_ADD_RUNTIMEFLAG2, J9SHR_RUNTIMEFLAG2_HUGE_PAGES},
+	{ OPTION_PREFAULT, PARSE_TYPE_EXACT, RESULT_DO_ADD_RUNTIMEFLAG2, J9SHR_RUNTIMEFLAG2_PREFAULT},
+	{ OPTION_RECLAIM_STALE, PARSE_TYPE_EXACT, RESULT_DO_ADD_RUNTIMEFLAG2, J9SHR_RUNTIMEFLAG2_RECLAIM_STALE},
+	{ OPTION_TIMESTAMP_CHECK_INTERVAL_EQUALS, PARSE_TYPE_STARTSWITH, RESULT_DO_SET_TIMESTAMP_CHECK_INTERVAL, 0},
 	{ NULL, 0, 0 }
 };
 
@@ -730,6 +738,22 @@ parseArgs(J9JavaVM* vm, char* options, U_64* runtimeFlags, U_64* runtimeFlags2,
 			*runtimeFlags |= J9SHR_RUNTIMEFLAG_DO_NOT_CREATE_CACHE;
 			continue;
 		}
+		case RESULT_DO_SET_TIMESTAMP_CHECK_INTERVAL:
+		{
+			UDATA temp = 0;
+			char* optString = options + strlen(OPTION_TIMESTAMP_CHECK_INTERVAL_EQUALS);
+			char* cursor = optString;
+			if ((scan_udata(&cursor, &temp) == 0)
+				&& (temp <= U_32_MAX)
+			) {
+				vm->sharedCacheAPI->timestampCheckInterval = (U_32)temp;
+			} else {
+				SHRINIT_ERR_TRACE1(1, J9NLS_SHRC_SHRINIT_OPTION_INVALID_PARAM, OPTION_TIMESTAMP_CHECK_INTERVAL_EQUALS);
+				return RESULT_PARSE_FAILED;
+			}
+			options += strlen(OPTION_TIMESTAMP_CHECK_INTERVAL_EQUALS) + (cursor - optString) + 1;
+			continue;
+		}
 		case RESULT_DO_CREATE_LAYER:
 		{
 			vm->sharedCacheAPI->layer = SHRINIT_CREATE_NEW_LAYER;
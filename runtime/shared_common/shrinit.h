@@ -200,6 +200,10 @@ typedef struct J9SharedClassesOptions {
 #define OPTION_TEST_HALF_PAGESIZE "testHalfPageSize"
 #define OPTION_EXTRA_STARTUPHINTS_EQUALS "extraStartupHints="
 #define OPTION_SHARE_LAMBDAFORM "shareLambdaForm" /* internal option for dev/testing */
+#define OPTION_HUGE_PAGES "hugePages"
+#define OPTION_PREFAULT "prefault"
+#define OPTION_RECLAIM_STALE "reclaimStale"
+#define OPTION_TIMESTAMP_CHECK_INTERVAL_EQUALS "timestampCheckInterval="
 
 /* public options for printallstats= and printstats=  */
 #define SUB_OPTION_PRINTSTATS_ALL "all"
@@ -282,6 +286,7 @@ typedef struct J9SharedClassesOptions {
 #define RESULT_DO_PRINT_TOP_LAYER_STATS_EQUALS 54
 #define RESULT_DO_ADD_RUNTIMEFLAG2 55
 #define RESULT_DO_SET_EXTRA_STARTUPHINTS 56
+#define RESULT_DO_SET_TIMESTAMP_CHECK_INTERVAL 57
 
 #define PARSE_TYPE_EXACT 1
 #define PARSE_TYPE_STARTSWITH 2
@@ -315,6 +320,7 @@ typedef struct J9SharedClassesOptions {
 #define HELPTEXT_ADJUST_MAXJITDATA_EQUALS OPTION_ADJUST_MAXJITDATA_EQUALS"<size>"
 #define HELPTEXT_LAYER_EQUALS OPTION_LAYER_EQUALS "<number>"
 #define HELPTEXT_OPTION_EXTRA_STARTUPHINTS_EQUALS OPTION_EXTRA_STARTUPHINTS_EQUALS"<number>"
+#define HELPTEXT_OPTION_TIMESTAMP_CHECK_INTERVAL_EQUALS OPTION_TIMESTAMP_CHECK_INTERVAL_EQUALS"<ms>"
 
 #define HELPTEXT_NEWLINE {"", 0, 0, 0, 0}
 
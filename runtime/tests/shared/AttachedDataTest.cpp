@@ -32,6 +32,7 @@ extern "C"
 
 #define FIND_ATTACHED_DATA_RETRY_COUNT 1
 #define MAIN_THREAD_WAIT_TIME 1
+#define CONCURRENT_STORE_THREADS 4
 
 #define J9THREAD_PROC
 
@@ -49,6 +50,7 @@ extern "C" {
 	IDATA createThread(J9JavaVM *vm, omrthread_t *osThread, J9VMThread **vmThread, omrthread_entrypoint_t entryPoint, void *entryArg);
 	int J9THREAD_PROC startReader(void *entryArg);
 	int J9THREAD_PROC startWriter(void *entryArg);
+	int J9THREAD_PROC startConcurrentStore(void *entryArg);
 	IDATA testAttachedData(J9JavaVM* vm);
 }
 
@@ -76,6 +78,7 @@ public:
 	IDATA initializeAttachedData(J9JavaVM *vm);
 	IDATA freeAttachedData(J9JavaVM *vm);
 	IDATA StoreAttachedDataSuccess(J9JavaVM *vm);
+	IDATA StoreAttachedDataStride(J9JavaVM *vm, I_32 firstIndex, I_32 stride);
 	IDATA StoreAttachedDataFailure(J9JavaVM *vm);
 	IDATA FindAttachedDataSuccess(J9JavaVM *vm);
 	IDATA FindAttachedDataFailure(J9JavaVM *vm);
@@ -111,6 +114,16 @@ public:
 	}
 };
 
+struct ConcurrentStoreThread {
+	AttachedDataTest *adt;
+	omrthread_t osThread;
+	J9VMThread *vmThread;
+	omrthread_monitor_t monitor;
+	I_32 firstIndex;
+	IDATA rc;
+	bool exited;
+};
+
 bool
 AttachedDataTest::isThreadSuspended(void)
 {
@@ -504,6 +517,30 @@ AttachedDataTest::StoreAttachedDataSuccess(J9JavaVM *vm)
 	return rc;
 }
 
+/* Store every stride'th item of dataList, starting at firstIndex. Each store is expected to succeed. */
+IDATA
+AttachedDataTest::StoreAttachedDataStride(J9JavaVM *vm, I_32 firstIndex, I_32 stride)
+{
+	IDATA rc = PASS;
+	UDATA rV = 0;
+	I_32 i;
+	J9VMThread *currentThread;
+	const char *testName = "StoreAttachedDataStride";
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	currentThread = vm->internalVMFunctions->currentVMThread(vm);
+	for (i = firstIndex; i < NUM_DATA_OBJECTS; i += stride) {
+		rV = (UDATA) vm->sharedClassConfig->storeAttachedData(currentThread, dataList[i].keyAddress, &dataList[i].data, false);
+		if (0 != rV) {
+			ERRPRINTF2("j9shr_storeAttachedData failed with rc: 0x%x for data index: %d\n", rV, i);
+			rc = FAIL;
+			break;
+		}
+	}
+
+	return rc;
+}
+
 IDATA
 AttachedDataTest::StoreAttachedDataFailure(J9JavaVM *vm)
 {
@@ -1564,6 +1601,111 @@ _exitCloseCache:
 	return (int)rc;
 }
 
+int J9THREAD_PROC
+startConcurrentStore(void *entryArg) {
+	IDATA rc = FAIL;
+	ConcurrentStoreThread *storeThread = (ConcurrentStoreThread *)entryArg;
+	J9JavaVM *vm = storeThread->adt->vm;
+	J9VMThread *currentThread = vm->internalVMFunctions->currentVMThread(vm);
+
+	vm->internalVMFunctions->internalEnterVMFromJNI(currentThread);
+	rc = storeThread->adt->StoreAttachedDataStride(vm, storeThread->firstIndex, CONCURRENT_STORE_THREADS);
+	vm->internalVMFunctions->internalExitVMToJNI(currentThread);
+	vm->internalVMFunctions->threadCleanup(currentThread, 0);
+
+	omrthread_monitor_enter(storeThread->monitor);
+	storeThread->rc = rc;
+	storeThread->exited = true;
+	omrthread_monitor_notify_all(storeThread->monitor);
+	omrthread_monitor_exit(storeThread->monitor);
+	return (int)rc;
+}
+
+/**
+ * Store attached data from several threads of the same JVM at once. The stores are batched
+ * behind the thread holding the write mutex, and every item must be found afterwards.
+ */
+IDATA
+testConcurrentStore(J9JavaVM *vm) {
+	const char *testName = "testConcurrentStore";
+	IDATA rc = PASS;
+	I_32 started = 0;
+	I_32 i;
+	AttachedDataTest adt;
+	ConcurrentStoreThread storeThreads[CONCURRENT_STORE_THREADS];
+	omrthread_monitor_t monitor = NULL;
+	J9VMThread *currentThread = vm->internalVMFunctions->currentVMThread(vm);
+	PORT_ACCESS_FROM_JAVAVM(vm);
+
+	INFOPRINTF("Running testConcurrentStore\n\t");
+	adt.vm = vm;
+
+	rc = adt.openTestCache(vm, NULL, 0, J9PORT_SHR_CACHE_TYPE_NONPERSISTENT, 0, 0);
+	if (FAIL == rc) {
+		ERRPRINTF("openTestCache failed");
+		goto _exitCloseCache;
+	}
+
+	rc = adt.initializeAttachedData(vm);
+	if (FAIL == rc) {
+		ERRPRINTF("initializeAttachedData failed");
+		goto _exitClearData;
+	}
+
+	if (0 != omrthread_monitor_init_with_name(&monitor, 0, "testConcurrentStore")) {
+		ERRPRINTF("Failed to create monitor");
+		rc = FAIL;
+		goto _exitClearData;
+	}
+
+	/* Create all store threads in suspended state so that they start storing together */
+	for (started = 0; started < CONCURRENT_STORE_THREADS; started++) {
+		storeThreads[started].adt = &adt;
+		storeThreads[started].monitor = monitor;
+		storeThreads[started].firstIndex = started;
+		storeThreads[started].rc = FAIL;
+		storeThreads[started].exited = false;
+		rc = createThread(vm, &storeThreads[started].osThread, &storeThreads[started].vmThread, startConcurrentStore, &storeThreads[started]);
+		if (FAIL == rc) {
+			ERRPRINTF("createThread failed");
+			break;
+		}
+	}
+
+	/* The store threads need VM access to store */
+	vm->internalVMFunctions->internalExitVMToJNI(currentThread);
+	omrthread_monitor_enter(monitor);
+	for (i = 0; i < started; i++) {
+		omrthread_resume(storeThreads[i].osThread);
+	}
+	for (i = 0; i < started; i++) {
+		while (!storeThreads[i].exited) {
+			omrthread_monitor_wait(monitor);
+		}
+		if (FAIL == storeThreads[i].rc) {
+			rc = FAIL;
+		}
+	}
+	omrthread_monitor_exit(monitor);
+	vm->internalVMFunctions->internalEnterVMFromJNI(currentThread);
+	omrthread_monitor_destroy(monitor);
+
+	if (PASS == rc) {
+		rc = adt.FindAttachedDataSuccess(vm);
+		if (FAIL == rc) {
+			ERRPRINTF("FindAttachedDataSuccess failed after concurrent stores");
+		}
+	}
+
+_exitClearData:
+	adt.freeAttachedData(vm);
+
+_exitCloseCache:
+	adt.closeTestCache(vm, true);
+
+	return rc;
+}
+
 IDATA
 testFindReadOnly(J9JavaVM *vm) {
 	const char *testName = "testFindReadOnly";
@@ -1885,6 +2027,11 @@ _exitCloseCache:
 		ERRPRINTF("testFindReadOnly failed");
 	}
 
+	if (FAIL == testConcurrentStore(vm)) {
+		ERRPRINTF("testConcurrentStore failed");
+		rc = FAIL;
+	}
+
 	UnitTest::unitTest = UnitTest::NO_TEST;
 	UnitTest::cacheSize = 0;
 	UnitTest::cacheMemory = NULL;
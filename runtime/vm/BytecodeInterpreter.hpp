@@ -154,6 +154,10 @@ ffiCallWithSetJmpForUpcall(J9VMThread *currentThread, ffi_cif *cif, void *functi
 #else /* FFI_NATIVE_RAW_API */
 ffiCallWithSetJmpForUpcall(J9VMThread *currentThread, ffi_cif *cif, void *function, UDATA *returnStorage, void **values);
 #endif /* FFI_NATIVE_RAW_API */
+#if defined(J9VM_FFI_DIRECT_CALLOUT)
+extern void
+ffiDirectCallWithSetJmpForUpcall(J9VMThread *currentThread, J9FFICalloutData *calloutData, void *function, UDATA *returnStorage, U_64 *args);
+#endif /* defined(J9VM_FFI_DIRECT_CALLOUT) */
 }
 #endif /* JAVA_SPEC_VERSION >= 16 */
 
@@ -5641,11 +5645,25 @@ done:
 			VM_VMAccess::inlineExitVMToJNI(_currentThread);
 		}
 		VM_VMHelpers::beforeJNICall(_currentThread);
+#if defined(J9VM_FFI_DIRECT_CALLOUT)
+		if (J9_FFI_DIRECT_CALLOUT_NONE != ((J9FFICalloutData *)cif)->directCalloutType) {
+			/* All arguments are integral or pointers held in 64-bit slots, so they
+			 * are passed by value without involving the libffi marshaller.
+			 */
+			U_64 directArgs[J9VM_FFI_DIRECT_CALLOUT_MAX_ARGS];
+			for (U_32 i = 0; i < ffiArgCount; i++) {
+				directArgs[i] = *(U_64 *)values[i];
+			}
+			ffiDirectCallWithSetJmpForUpcall(_currentThread, (J9FFICalloutData *)cif, function, returnStorage, directArgs);
+		} else
+#endif /* defined(J9VM_FFI_DIRECT_CALLOUT) */
+		{
 #if FFI_NATIVE_RAW_API
-		ffiCallWithSetJmpForUpcall(_currentThread, cif, function, returnStorage, values, values_raw);
+			ffiCallWithSetJmpForUpcall(_currentThread, cif, function, returnStorage, values, values_raw);
 #else /* FFI_NATIVE_RAW_API */
-		ffiCallWithSetJmpForUpcall(_currentThread, cif, function, returnStorage, values);
+			ffiCallWithSetJmpForUpcall(_currentThread, cif, function, returnStorage, values);
 #endif /* FFI_NATIVE_RAW_API */
+		}
 		VM_VMHelpers::afterJNICall(_currentThread);
 #if JAVA_SPEC_VERSION >= 21
 		/* Re-enter VM after non-critical downcalls. */
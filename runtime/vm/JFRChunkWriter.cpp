@@ -565,6 +565,33 @@ VM_JFRChunkWriter::writeFrameTypeCheckpointEvent()
 	return dataStart;
 }
 
+U_8 *
+VM_JFRChunkWriter::writeCompilerTypeCheckpointEvent()
+{
+	U_8 *dataStart = NULL;
+
+	/* Only the newer Compilation layout refers to the CompilerType constant pool. */
+	if ((0 != _vm->jfrState.compilationWithCompilerTypeID) && (_constantPoolTypes.getCompilationCount() > 0)) {
+		dataStart = writeCheckpointEventHeader(Generic, 1);
+
+		/* class ID */
+		_bufferWriter->writeLEB128(_vm->jfrState.compilerTypeTypeID);
+
+		/* number of compilers */
+		_bufferWriter->writeLEB128(1);
+
+		/* constant index */
+		_bufferWriter->writeLEB128(JIT_COMPILER_TYPE_KEY);
+
+		writeStringLiteral("OpenJ9 JIT");
+
+		/* write size */
+		writeEventSize(dataStart);
+	}
+
+	return dataStart;
+}
+
 U_8 *
 VM_JFRChunkWriter::writeSymbolTableCheckpointEvent()
 {
@@ -1448,6 +1475,127 @@ VM_JFRChunkWriter::writeSystemGCEvent(void *anElement, void *userData)
 	writeEventSize(bufferWriter, dataStart);
 }
 
+void
+VM_JFRChunkWriter::writeObjectAllocationSampleEvent(void *anElement, void *userData)
+{
+	ObjectAllocationSampleEntry *entry = (ObjectAllocationSampleEntry *)anElement;
+	VM_JFRChunkWriter *writer = (VM_JFRChunkWriter *)userData;
+	VM_BufferWriter *bufferWriter = writer->_bufferWriter;
+
+	/* Reserve size field */
+	U_8 *dataStart = reserveEventSize(bufferWriter);
+
+	/* Write event type */
+	bufferWriter->writeLEB128(writer->_vm->jfrState.objectAllocationSampleTypeID);
+
+	/* Write start time */
+	bufferWriter->writeLEB128(entry->ticks);
+
+	/* Write event thread index */
+	bufferWriter->writeLEB128(entry->eventThreadIndex);
+
+	/* Write stacktrace index */
+	bufferWriter->writeLEB128(entry->stackTraceIndex);
+
+	/* Write object class index */
+	bufferWriter->writeLEB128(entry->objectClassIndex);
+
+	/* Write weight in bytes */
+	bufferWriter->writeLEB128(entry->weight);
+
+	/* Write size */
+	writeEventSize(bufferWriter, dataStart);
+}
+
+void
+VM_JFRChunkWriter::writeGCPhasePauseEvent(void *anElement, void *userData)
+{
+	GCPhasePauseEntry *entry = (GCPhasePauseEntry *)anElement;
+	VM_JFRChunkWriter *writer = (VM_JFRChunkWriter *)userData;
+	VM_BufferWriter *bufferWriter = writer->_bufferWriter;
+
+	/* Reserve size field */
+	U_8 *dataStart = reserveEventSize(bufferWriter);
+
+	/* Write event type */
+	bufferWriter->writeLEB128(writer->_vm->jfrState.gcPhasePauseTypeID);
+
+	/* Write start time */
+	bufferWriter->writeLEB128(entry->ticks);
+
+	/* Write duration time which is always in ticks, in our case nanos */
+	bufferWriter->writeLEB128(entry->duration);
+
+	/* Write event thread index */
+	bufferWriter->writeLEB128(entry->eventThreadIndex);
+
+	/* Write GC ID */
+	bufferWriter->writeLEB128(entry->gcId);
+
+	/* Write phase name */
+	writer->writeStringLiteral(entry->globalGC ? "Global GC" : "Local GC");
+
+	/* Write size */
+	writeEventSize(bufferWriter, dataStart);
+}
+
+void
+VM_JFRChunkWriter::writeCompilationEvent(void *anElement, void *userData)
+{
+	CompilationEntry *entry = (CompilationEntry *)anElement;
+	VM_JFRChunkWriter *writer = (VM_JFRChunkWriter *)userData;
+	VM_BufferWriter *bufferWriter = writer->_bufferWriter;
+	U_64 compilationWithCompilerTypeID = writer->_vm->jfrState.compilationWithCompilerTypeID;
+
+	/* Reserve size field */
+	U_8 *dataStart = reserveEventSize(bufferWriter);
+
+	/* Write event type */
+	if (0 != compilationWithCompilerTypeID) {
+		bufferWriter->writeLEB128(compilationWithCompilerTypeID);
+	} else {
+		bufferWriter->writeLEB128(writer->_vm->jfrState.compilationTypeID);
+	}
+
+	/* Write start time */
+	bufferWriter->writeLEB128(entry->ticks);
+
+	/* Write duration time which is always in ticks, in our case nanos */
+	bufferWriter->writeLEB128(entry->duration);
+
+	/* Write event thread index */
+	bufferWriter->writeLEB128(entry->eventThreadIndex);
+
+	/* Write compile ID */
+	bufferWriter->writeLEB128(entry->compileId);
+
+	/* Write compiler index */
+	if (0 != compilationWithCompilerTypeID) {
+		bufferWriter->writeLEB128(JIT_COMPILER_TYPE_KEY);
+	}
+
+	/* Write method index */
+	bufferWriter->writeLEB128(entry->methodIndex);
+
+	/* Write optimization level */
+	bufferWriter->writeLEB128(entry->compileLevel);
+
+	/* Write succeeded */
+	bufferWriter->writeBoolean(entry->succeeded);
+
+	/* Write isOsr */
+	bufferWriter->writeBoolean(entry->isOSR);
+
+	/* Write code size */
+	bufferWriter->writeLEB128(entry->codeSize);
+
+	/* Write inlined bytes which are not tracked by the JIT */
+	bufferWriter->writeLEB128((U_64)0);
+
+	/* Write size */
+	writeEventSize(bufferWriter, dataStart);
+}
+
 void
 VM_JFRChunkWriter::writeModuleRequire(void *anElement, void *userData)
 {
@@ -88,6 +88,7 @@ enum MetadataTypeID {
 	ClassLoaderStatisticsID = 101,
 	PhysicalMemoryID = 108,
 	ExecutionSampleID = 109,
+	NativeMethodSampleID = 110,
 	ThreadDumpID = 111,
 	NativeLibraryID = 112,
 	ModuleRequireID = 113,
@@ -198,6 +199,13 @@ private:
 	static constexpr int SYSTEM_GC_EVENT_SIZE = (2 * LEB128_64_SIZE) + (3 * LEB128_32_SIZE) + sizeof(U_8);
 	static constexpr int MODULE_REQUIRE_EVENT_SIZE = LEB128_64_SIZE + (4 * LEB128_32_SIZE);
 	static constexpr int MODULE_EXPORT_EVENT_SIZE = LEB128_64_SIZE + (4 * LEB128_32_SIZE);
+	static constexpr int OBJECT_ALLOCATION_SAMPLE_EVENT_SIZE = (3 * LEB128_64_SIZE) + (4 * LEB128_32_SIZE);
+	static constexpr int GC_PHASE_PAUSE_EVENT_SIZE = (3 * LEB128_64_SIZE) + (3 * LEB128_32_SIZE) + STRING_HEADER_LENGTH + sizeof("Global GC");
+	static constexpr int COMPILATION_EVENT_SIZE = (5 * LEB128_64_SIZE) + (6 * LEB128_32_SIZE) + (2 * sizeof(U_8));
+	static constexpr int COMPILER_TYPE_ENTRY_SIZE = CHECKPOINT_EVENT_HEADER_AND_FOOTER + STRING_CONSTANT_SIZE;
+
+	/* Key of the only entry in the CompilerType constant pool */
+	static constexpr int JIT_COMPILER_TYPE_KEY = 1;
 
 	static constexpr int METADATA_ID = 1;
 
@@ -364,6 +372,8 @@ done:
 
 			writeFrameTypeCheckpointEvent();
 
+			writeCompilerTypeCheckpointEvent();
+
 			if (0 == _vm->jfrState.jfrChunkCount) {
 				writeNarrowOOPModeTypesEvent();
 			}
@@ -414,6 +424,12 @@ done:
 
 			pool_do(_constantPoolTypes.getSystemGCTable(), &writeSystemGCEvent, _bufferWriter);
 
+			pool_do(_constantPoolTypes.getObjectAllocationSampleTable(), &writeObjectAllocationSampleEvent, this);
+
+			pool_do(_constantPoolTypes.getGCPhasePauseTable(), &writeGCPhasePauseEvent, this);
+
+			pool_do(_constantPoolTypes.getCompilationTable(), &writeCompilationEvent, this);
+
 			pool_do(_constantPoolTypes.getModuleRequireTable(), &writeModuleRequire, _bufferWriter);
 
 			pool_do(_constantPoolTypes.getModuleExportTable(), &writeModuleExport, _bufferWriter);
@@ -481,7 +497,7 @@ done:
 		U_8 *dataStart = reserveEventSize(_bufferWriter);
 
 		/* write event type */
-		_bufferWriter->writeLEB128(ExecutionSampleID);
+		_bufferWriter->writeLEB128(entry->isNative ? NativeMethodSampleID : ExecutionSampleID);
 
 		/* write start time */
 		_bufferWriter->writeLEB128(entry->ticks);
@@ -822,6 +838,8 @@ done:
 
 	U_8 *writeFrameTypeCheckpointEvent();
 
+	U_8 *writeCompilerTypeCheckpointEvent();
+
 	U_8 *writeSymbolTableCheckpointEvent();
 
 	U_8 *writeStacktraceCheckpointEvent();
@@ -862,6 +880,12 @@ done:
 
 	static void writeSystemGCEvent(void *anElement, void *userData);
 
+	static void writeObjectAllocationSampleEvent(void *anElement, void *userData);
+
+	static void writeGCPhasePauseEvent(void *anElement, void *userData);
+
+	static void writeCompilationEvent(void *anElement, void *userData);
+
 	static void writeModuleRequire(void *anElement, void *userData);
 
 	static void writeModuleExport(void *anElement, void *userData);
@@ -948,6 +972,12 @@ done:
 
 		requiredBufferSize += (_constantPoolTypes.getsystemGCCount() * SYSTEM_GC_EVENT_SIZE);
 
+		requiredBufferSize += (_constantPoolTypes.getObjectAllocationSampleCount() * OBJECT_ALLOCATION_SAMPLE_EVENT_SIZE);
+
+		requiredBufferSize += (_constantPoolTypes.getGCPhasePauseCount() * GC_PHASE_PAUSE_EVENT_SIZE);
+
+		requiredBufferSize += COMPILER_TYPE_ENTRY_SIZE + (_constantPoolTypes.getCompilationCount() * COMPILATION_EVENT_SIZE);
+
 		requiredBufferSize += (_constantPoolTypes.getModuleRequireCount() * MODULE_REQUIRE_EVENT_SIZE);
 
 		requiredBufferSize += (_constantPoolTypes.getModuleExportCount() * MODULE_EXPORT_EVENT_SIZE);
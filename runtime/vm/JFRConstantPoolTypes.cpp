@@ -118,8 +118,13 @@ UDATA
 VM_JFRConstantPoolTypes::stackTraceHashFn(void *key, void *userData)
 {
 	StackTraceEntry *entry = (StackTraceEntry*) key;
+	UDATA hash = entry->pcCount;
 
-	return (U_64)(UDATA)entry->vmThread ^ (U_64)entry->ticks;
+	for (UDATA i = 0; i < entry->pcCount; i++) {
+		hash = (hash * 31) ^ entry->pcs[i];
+	}
+
+	return hash;
 }
 
 UDATA
@@ -128,7 +133,8 @@ VM_JFRConstantPoolTypes::stackTraceHashEqualFn(void *tableNode, void *queryNode,
 	StackTraceEntry *tableEntry = (StackTraceEntry *) tableNode;
 	StackTraceEntry *queryEntry = (StackTraceEntry *) queryNode;
 
-	return tableEntry->vmThread == queryEntry->vmThread && tableEntry->ticks == queryEntry->ticks;
+	return (tableEntry->pcCount == queryEntry->pcCount)
+			&& (0 == memcmp(tableEntry->pcs, queryEntry->pcs, tableEntry->pcCount * sizeof(UDATA)));
 }
 
 UDATA
@@ -990,7 +996,7 @@ done:
 }
 
 U_32
-VM_JFRConstantPoolTypes::addStackTraceEntry(J9VMThread *vmThread, I_64 ticks, U_32 numOfFrames)
+VM_JFRConstantPoolTypes::addStackTraceEntry(J9VMThread *vmThread, I_64 ticks, UDATA *pcs, UDATA pcCount, U_32 numOfFrames)
 {
 	U_32 index = U_32_MAX;
 	StackTraceEntry *entry = NULL;
@@ -999,6 +1005,8 @@ VM_JFRConstantPoolTypes::addStackTraceEntry(J9VMThread *vmThread, I_64 ticks, U_
 	entry = &entryBuffer;
 	entry->vmThread = vmThread;
 	entry->ticks = ticks;
+	entry->pcs = pcs;
+	entry->pcCount = pcCount;
 	_buildResult = OK;
 
 	entry = (StackTraceEntry *) hashTableFind(_stackTraceTable, entry);
@@ -1054,6 +1062,7 @@ VM_JFRConstantPoolTypes::addExecutionSampleEntry(J9JFRExecutionSample *execution
 	entry->vmThread = executionSampleData->vmThread;
 	entry->ticks = executionSampleData->startTicks;
 	entry->state = RUNNABLE; //TODO
+	entry->isNative = (J9JFR_EVENT_TYPE_NATIVE_METHOD_SAMPLE == executionSampleData->eventType);
 
 	entry->threadIndex = addThreadEntry(entry->vmThread);
 	if (isResultNotOKay()) goto done;
@@ -1385,6 +1394,88 @@ done:
 
 }
 
+void
+VM_JFRConstantPoolTypes::addObjectAllocationSampleEntry(J9JFRObjectAllocationSample *objectAllocationSampleData)
+{
+	ObjectAllocationSampleEntry *entry = (ObjectAllocationSampleEntry *)pool_newElement(_objectAllocationSampleTable);
+
+	if (NULL == entry) {
+		_buildResult = OutOfMemory;
+		goto done;
+	}
+
+	entry->ticks = objectAllocationSampleData->startTicks;
+	entry->weight = objectAllocationSampleData->weight;
+
+	entry->eventThreadIndex = addThreadEntry(objectAllocationSampleData->vmThread);
+	if (isResultNotOKay()) goto done;
+
+	entry->stackTraceIndex = consumeStackTrace(objectAllocationSampleData->vmThread, J9JFROBJECTALLOCATIONSAMPLE_STACKTRACE(objectAllocationSampleData), objectAllocationSampleData->stackTraceSize);
+	if (isResultNotOKay()) goto done;
+
+	entry->objectClassIndex = getClassEntry(objectAllocationSampleData->objectClass);
+	if (isResultNotOKay()) goto done;
+
+	_objectAllocationSampleCount += 1;
+
+done:
+	return;
+}
+
+void
+VM_JFRConstantPoolTypes::addGCPhasePauseEntry(J9JFRGCPhasePause *gcPhasePauseData)
+{
+	GCPhasePauseEntry *entry = (GCPhasePauseEntry *)pool_newElement(_gcPhasePauseTable);
+
+	if (NULL == entry) {
+		_buildResult = OutOfMemory;
+		goto done;
+	}
+
+	entry->ticks = gcPhasePauseData->startTicks;
+	entry->duration = gcPhasePauseData->duration;
+	entry->gcId = gcPhasePauseData->gcId;
+	entry->globalGC = gcPhasePauseData->globalGC;
+
+	entry->eventThreadIndex = addThreadEntry(gcPhasePauseData->vmThread);
+	if (isResultNotOKay()) goto done;
+
+	_gcPhasePauseCount += 1;
+
+done:
+	return;
+}
+
+void
+VM_JFRConstantPoolTypes::addCompilationEntry(J9JFRCompilation *compilationData)
+{
+	CompilationEntry *entry = (CompilationEntry *)pool_newElement(_compilationTable);
+
+	if (NULL == entry) {
+		_buildResult = OutOfMemory;
+		goto done;
+	}
+
+	entry->ticks = compilationData->startTicks;
+	entry->duration = compilationData->duration;
+	entry->compileId = compilationData->compileId;
+	entry->compileLevel = compilationData->compileLevel;
+	entry->succeeded = compilationData->succeeded;
+	entry->isOSR = compilationData->isOSR;
+	entry->codeSize = compilationData->codeSize;
+
+	entry->eventThreadIndex = addThreadEntry(compilationData->vmThread);
+	if (isResultNotOKay()) goto done;
+
+	entry->methodIndex = getMethodEntry(J9_ROM_METHOD_FROM_RAM_METHOD(compilationData->method), J9_CLASS_FROM_METHOD(compilationData->method));
+	if (isResultNotOKay()) goto done;
+
+	_compilationCount += 1;
+
+done:
+	return;
+}
+
 void
 VM_JFRConstantPoolTypes::printTables()
 {
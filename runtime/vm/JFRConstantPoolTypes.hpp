@@ -168,6 +168,7 @@ struct ExecutionSampleEntry {
 	J9VMThread *vmThread;
 	I_64 ticks;
 	ThreadState state;
+	bool isNative;
 	U_32 stackTraceIndex;
 	U_32 threadIndex;
 };
@@ -234,6 +235,9 @@ struct ThreadParkEntry {
 struct StackTraceEntry {
 	J9VMThread *vmThread;
 	I_64 ticks;
+	/* PCs cached by the stack walk, the key identifying the stack trace within the chunk */
+	UDATA *pcs;
+	UDATA pcCount;
 	U_32 numOfFrames;
 	U_32 index;
 	StackFrame *frames;
@@ -294,6 +298,34 @@ struct SystemGCEntry {
 	U_32 stackTraceIndex;
 };
 
+struct ObjectAllocationSampleEntry {
+	I_64 ticks;
+	U_32 eventThreadIndex;
+	U_32 stackTraceIndex;
+	U_32 objectClassIndex;
+	U_64 weight;
+};
+
+struct GCPhasePauseEntry {
+	I_64 ticks;
+	I_64 duration;
+	U_32 eventThreadIndex;
+	U_32 gcId;
+	BOOLEAN globalGC;
+};
+
+struct CompilationEntry {
+	I_64 ticks;
+	I_64 duration;
+	U_32 eventThreadIndex;
+	U_32 compileId;
+	U_32 methodIndex;
+	U_16 compileLevel;
+	BOOLEAN succeeded;
+	BOOLEAN isOSR;
+	U_64 codeSize;
+};
+
 struct ModuleRequireEntry {
 	I_64 ticks;
 	U_32 sourceModuleIndex;
@@ -437,6 +469,12 @@ private:
 	UDATA _nativeLibraryPathSizeTotal;
 	J9Pool *_systemGCTable;
 	UDATA _systemGCCount;
+	J9Pool *_objectAllocationSampleTable;
+	UDATA _objectAllocationSampleCount;
+	J9Pool *_gcPhasePauseTable;
+	UDATA _gcPhasePauseCount;
+	J9Pool *_compilationTable;
+	UDATA _compilationCount;
 	J9Pool *_moduleRequireTable;
 	UDATA _moduleRequireCount;
 	J9Pool *_moduleExportTable;
@@ -592,7 +630,7 @@ private:
 
 	U_32 addThreadGroupEntry(j9object_t threadGroup);
 
-	U_32 addStackTraceEntry(J9VMThread *vmThread, I_64 ticks, U_32 numOfFrames);
+	U_32 addStackTraceEntry(J9VMThread *vmThread, I_64 ticks, UDATA *pcs, UDATA pcCount, U_32 numOfFrames);
 
 	void printMergedStringTables();
 
@@ -722,6 +760,12 @@ public:
 
 	void addSystemGCEntry(J9JFRSystemGC *systemGCData);
 
+	void addObjectAllocationSampleEntry(J9JFRObjectAllocationSample *objectAllocationSampleData);
+
+	void addGCPhasePauseEntry(J9JFRGCPhasePause *gcPhasePauseData);
+
+	void addCompilationEntry(J9JFRCompilation *compilationData);
+
 	J9Pool *getExecutionSampleTable()
 	{
 		return _executionSampleTable;
@@ -822,6 +866,36 @@ public:
 		return _systemGCCount;
 	}
 
+	J9Pool *getObjectAllocationSampleTable()
+	{
+		return _objectAllocationSampleTable;
+	}
+
+	UDATA getObjectAllocationSampleCount()
+	{
+		return _objectAllocationSampleCount;
+	}
+
+	J9Pool *getGCPhasePauseTable()
+	{
+		return _gcPhasePauseTable;
+	}
+
+	UDATA getGCPhasePauseCount()
+	{
+		return _gcPhasePauseCount;
+	}
+
+	J9Pool *getCompilationTable()
+	{
+		return _compilationTable;
+	}
+
+	UDATA getCompilationCount()
+	{
+		return _compilationCount;
+	}
+
 	UDATA getThreadStartCount()
 	{
 		return _threadStartCount;
@@ -1043,6 +1117,7 @@ public:
 		while (NULL != event) {
 			switch (event->eventType) {
 			case J9JFR_EVENT_TYPE_EXECUTION_SAMPLE:
+			case J9JFR_EVENT_TYPE_NATIVE_METHOD_SAMPLE:
 				addExecutionSampleEntry((J9JFRExecutionSample *)event);
 				break;
 			case J9JFR_EVENT_TYPE_THREAD_START:
@@ -1081,6 +1156,15 @@ public:
 			case J9JFR_EVENT_TYPE_SYSTEM_GC:
 				addSystemGCEntry((J9JFRSystemGC *)event);
 				break;
+			case J9JFR_EVENT_TYPE_OBJECT_ALLOCATION_SAMPLE:
+				addObjectAllocationSampleEntry((J9JFRObjectAllocationSample *)event);
+				break;
+			case J9JFR_EVENT_TYPE_GC_PHASE_PAUSE:
+				addGCPhasePauseEntry((J9JFRGCPhasePause *)event);
+				break;
+			case J9JFR_EVENT_TYPE_COMPILATION:
+				addCompilationEntry((J9JFRCompilation *)event);
+				break;
 			default:
 				Assert_VM_unreachable();
 				break;
@@ -1119,12 +1203,23 @@ done:
 	U_32 consumeStackTrace(J9VMThread *walkThread, UDATA *walkStateCache, UDATA numberOfFrames) {
 		U_32 index = U_32_MAX;
 		UDATA expandedStackTraceCount = 0;
+		StackTraceEntry *entry = NULL;
+		StackTraceEntry entryBuffer = {0};
 
 		if (0 == numberOfFrames) {
 			index = 0;
 			goto done;
 		}
 
+		/* Events with the same stack share one stack trace entry, so each distinct stack is decoded and written once per chunk */
+		entryBuffer.pcs = walkStateCache;
+		entryBuffer.pcCount = numberOfFrames;
+		entry = (StackTraceEntry *)hashTableFind(_stackTraceTable, &entryBuffer);
+		if (NULL != entry) {
+			index = entry->index;
+			goto done;
+		}
+
 		expandedStackTraceCount = iterateStackTraceImpl(_currentThread, (j9object_t *)walkStateCache, NULL, NULL, FALSE, FALSE, numberOfFrames, FALSE);
 
 		_currentStackFrameBuffer = (StackFrame *)j9mem_allocate_memory(sizeof(StackFrame) * expandedStackTraceCount, J9MEM_CATEGORY_JFR);
@@ -1136,7 +1231,7 @@ done:
 
 		iterateStackTraceImpl(_currentThread, (j9object_t *)walkStateCache, &stackTraceCallback, this, FALSE, FALSE, numberOfFrames, FALSE);
 
-		index = addStackTraceEntry(walkThread, j9time_nano_time(), _currentFrameCount);
+		index = addStackTraceEntry(walkThread, j9time_nano_time(), walkStateCache, numberOfFrames, _currentFrameCount);
 		_stackFrameCount += (U_32)expandedStackTraceCount;
 		_currentStackFrameBuffer = NULL;
 
@@ -1729,6 +1824,12 @@ done:
 		, _nativeLibraryPathSizeTotal(0)
 		, _systemGCTable(NULL)
 		, _systemGCCount(0)
+		, _objectAllocationSampleTable(NULL)
+		, _objectAllocationSampleCount(0)
+		, _gcPhasePauseTable(NULL)
+		, _gcPhasePauseCount(0)
+		, _compilationTable(NULL)
+		, _compilationCount(0)
 		, _moduleRequireTable(NULL)
 		, _moduleRequireCount(0)
 		, _moduleExportTable(NULL)
@@ -1903,6 +2004,24 @@ done:
 			goto done;
 		}
 
+		_objectAllocationSampleTable = pool_new(sizeof(ObjectAllocationSampleEntry), 0, sizeof(U_64), 0, J9_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(privatePortLibrary));
+		if (NULL == _objectAllocationSampleTable) {
+			_buildResult = OutOfMemory;
+			goto done;
+		}
+
+		_gcPhasePauseTable = pool_new(sizeof(GCPhasePauseEntry), 0, sizeof(U_64), 0, J9_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(privatePortLibrary));
+		if (NULL == _gcPhasePauseTable) {
+			_buildResult = OutOfMemory;
+			goto done;
+		}
+
+		_compilationTable = pool_new(sizeof(CompilationEntry), 0, sizeof(U_64), 0, J9_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(privatePortLibrary));
+		if (NULL == _compilationTable) {
+			_buildResult = OutOfMemory;
+			goto done;
+		}
+
 		_moduleRequireTable = pool_new(sizeof(ModuleRequireEntry), 0, sizeof(U_64), 0, J9_GET_CALLSITE(), OMRMEM_CATEGORY_VM, POOL_FOR_PORT(privatePortLibrary));
 		if (NULL == _moduleRequireTable) {
 			_buildResult = OutOfMemory;
@@ -2012,6 +2131,9 @@ done:
 		pool_kill(_systemProcessTable);
 		pool_kill(_nativeLibrariesTable);
 		pool_kill(_systemGCTable);
+		pool_kill(_objectAllocationSampleTable);
+		pool_kill(_gcPhasePauseTable);
+		pool_kill(_compilationTable);
 		pool_kill(_moduleRequireTable);
 		pool_kill(_moduleExportTable);
 		j9mem_free_memory(_globalStringTable);
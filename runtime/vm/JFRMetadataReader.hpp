@@ -0,0 +1,353 @@
+/*******************************************************************************
+ * Copyright IBM Corp. and others 2025
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ *******************************************************************************/
+#if !defined(JFRMETADATAREADER_HPP_)
+#define JFRMETADATAREADER_HPP_
+
+#include "j9cfg.h"
+#include "j9.h"
+
+#if defined(J9VM_OPT_JFR)
+
+#include "JFRChunkWriter.hpp"
+
+/**
+ * Expected layout of a type described in the metadata blob. The type ID is
+ * stored only if the type exists and its fields match fieldNames exactly.
+ */
+struct JFRMetadataTypeLayout {
+	const char *className;
+	/* NULL terminated list of field names, in declaration order */
+	const char * const *fieldNames;
+	U_64 *typeID;
+};
+
+/**
+ * Reads the string pool and element tree of the metadata blob, which has the
+ * same format as the body of a chunk metadata event, to look up type IDs by name.
+ */
+class VM_JFRMetadataReader {
+	/*
+	 * Data members
+	 */
+private:
+	static constexpr UDATA MAX_ELEMENT_DEPTH = 16;
+	static constexpr UDATA MAX_LAYOUTS = 8;
+
+	struct ClassMatch {
+		const char *className;
+		U_64 id;
+		bool candidate[MAX_LAYOUTS];
+		UDATA matchedFields[MAX_LAYOUTS];
+	};
+
+	J9PortLibrary *privatePortLibrary;
+	U_8 *_cursor;
+	U_8 *_end;
+	bool _ok;
+	const char **_strings;
+	U_64 _stringCount;
+	char *_stringData;
+	JFRMetadataTypeLayout *_layouts;
+	UDATA _layoutCount;
+
+protected:
+
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	U_64
+	readLEB128()
+	{
+		U_64 result = 0;
+
+		for (UDATA i = 0; i < 9; i++) {
+			if (_cursor >= _end) {
+				_ok = false;
+				result = 0;
+				break;
+			}
+			U_8 byte = *_cursor++;
+			if (8 == i) {
+				/* the ninth byte carries a full 8 bits */
+				result |= (U_64)byte << 56;
+				break;
+			}
+			result |= (U_64)(byte & 0x7F) << (7 * i);
+			if (0 == (byte & 0x80)) {
+				break;
+			}
+		}
+
+		return result;
+	}
+
+	/**
+	 * Read a string pool index.
+	 *
+	 * @return the string, or NULL if the index is invalid or refers to a null string
+	 */
+	const char *
+	readStringReference()
+	{
+		U_64 index = readLEB128();
+		const char *result = NULL;
+
+		if (index < _stringCount) {
+			result = _strings[index];
+		} else {
+			_ok = false;
+		}
+
+		return result;
+	}
+
+	bool
+	readStringPool()
+	{
+		UDATA remaining = 0;
+		char *data = NULL;
+
+		_stringCount = readLEB128();
+		remaining = _end - _cursor;
+		/* every string takes at least one byte */
+		if (!_ok || (_stringCount > remaining)) {
+			_ok = false;
+			goto done;
+		}
+
+		_strings = (const char **)j9mem_allocate_memory((UDATA)_stringCount * sizeof(char *), J9MEM_CATEGORY_JFR);
+		/* decoded strings never take more bytes than their encoding, plus a terminator each */
+		_stringData = (char *)j9mem_allocate_memory(remaining + (UDATA)_stringCount, J9MEM_CATEGORY_JFR);
+		if ((NULL == _strings) || (NULL == _stringData)) {
+			_ok = false;
+			goto done;
+		}
+
+		data = _stringData;
+		for (U_64 i = 0; _ok && (i < _stringCount); i++) {
+			U_64 encoding = readLEB128();
+			U_64 length = 0;
+
+			_strings[i] = NULL;
+			switch (encoding) {
+			case NullString:
+				break;
+			case EmptyString:
+				*data = '\0';
+				_strings[i] = data;
+				data += 1;
+				break;
+			case StringConstant:
+				/* not expected in the metadata, the string stays unnamed */
+				readLEB128();
+				break;
+			case UTF8:
+			case Latin1:
+				length = readLEB128();
+				if (!_ok || (length > (U_64)(_end - _cursor))) {
+					_ok = false;
+					break;
+				}
+				memcpy(data, _cursor, (UDATA)length);
+				_cursor += length;
+				data[length] = '\0';
+				_strings[i] = data;
+				data += length + 1;
+				break;
+			case UTF16:
+				length = readLEB128();
+				if (!_ok || (length > (U_64)(_end - _cursor))) {
+					_ok = false;
+					break;
+				}
+				_strings[i] = data;
+				for (U_64 c = 0; _ok && (c < length); c++) {
+					U_64 ch = readLEB128();
+					/* type and field names are ASCII; anything else can never match */
+					*data++ = (ch < 0x80) ? (char)ch : '?';
+				}
+				*data++ = '\0';
+				break;
+			default:
+				_ok = false;
+				break;
+			}
+		}
+
+done:
+		return _ok;
+	}
+
+	static U_64
+	parseID(const char *value)
+	{
+		U_64 id = 0;
+
+		if (NULL != value) {
+			for (const char *c = value; ('0' <= *c) && (*c <= '9'); c++) {
+				id = (id * 10) + (U_64)(*c - '0');
+			}
+		}
+
+		return id;
+	}
+
+	void
+	startClass(ClassMatch *match, const char *className, const char *idValue)
+	{
+		match->className = className;
+		match->id = parseID(idValue);
+		for (UDATA i = 0; i < _layoutCount; i++) {
+			match->candidate[i] = (0 != match->id) && (0 == strcmp(className, _layouts[i].className));
+			match->matchedFields[i] = 0;
+		}
+	}
+
+	void
+	matchField(ClassMatch *match, const char *fieldName)
+	{
+		for (UDATA i = 0; i < _layoutCount; i++) {
+			if (match->candidate[i]) {
+				const char *expected = _layouts[i].fieldNames[match->matchedFields[i]];
+				if ((NULL != fieldName) && (NULL != expected) && (0 == strcmp(fieldName, expected))) {
+					match->matchedFields[i] += 1;
+				} else {
+					match->candidate[i] = false;
+				}
+			}
+		}
+	}
+
+	void
+	endClass(ClassMatch *match)
+	{
+		for (UDATA i = 0; i < _layoutCount; i++) {
+			if (match->candidate[i] && (NULL == _layouts[i].fieldNames[match->matchedFields[i]])) {
+				*_layouts[i].typeID = match->id;
+			}
+		}
+	}
+
+	/**
+	 * Read an element and its children, recording the IDs of any classes
+	 * which match one of the expected layouts.
+	 *
+	 * @param depth[in] nesting depth of the element
+	 * @param enclosingClass[in] the class being matched if this element is one of its children, otherwise NULL
+	 */
+	void
+	readElement(UDATA depth, ClassMatch *enclosingClass)
+	{
+		const char *elementName = NULL;
+		const char *nameAttribute = NULL;
+		const char *idAttribute = NULL;
+		U_64 attributeCount = 0;
+		U_64 childCount = 0;
+		ClassMatch match;
+		ClassMatch *childClass = NULL;
+
+		if (depth > MAX_ELEMENT_DEPTH) {
+			_ok = false;
+			goto done;
+		}
+
+		elementName = readStringReference();
+		attributeCount = readLEB128();
+		for (U_64 i = 0; _ok && (i < attributeCount); i++) {
+			const char *key = readStringReference();
+			const char *value = readStringReference();
+			if (NULL != key) {
+				if (0 == strcmp(key, "name")) {
+					nameAttribute = value;
+				} else if (0 == strcmp(key, "id")) {
+					idAttribute = value;
+				}
+			}
+		}
+		if (!_ok || (NULL == elementName)) {
+			_ok = false;
+			goto done;
+		}
+
+		if ((0 == strcmp(elementName, "class")) && (NULL != nameAttribute)) {
+			startClass(&match, nameAttribute, idAttribute);
+			childClass = &match;
+		} else if ((NULL != enclosingClass) && (0 == strcmp(elementName, "field"))) {
+			matchField(enclosingClass, nameAttribute);
+		}
+
+		childCount = readLEB128();
+		for (U_64 i = 0; _ok && (i < childCount); i++) {
+			readElement(depth + 1, childClass);
+		}
+
+		if (_ok && (NULL != childClass)) {
+			endClass(childClass);
+		}
+done:
+		return;
+	}
+
+protected:
+
+public:
+	VM_JFRMetadataReader(J9JavaVM *vm, U_8 *blob, UDATA blobSize, JFRMetadataTypeLayout *layouts, UDATA layoutCount)
+		: privatePortLibrary(vm->portLibrary)
+		, _cursor(blob)
+		, _end(blob + blobSize)
+		, _ok((NULL != blob) && (layoutCount <= MAX_LAYOUTS))
+		, _strings(NULL)
+		, _stringCount(0)
+		, _stringData(NULL)
+		, _layouts(layouts)
+		, _layoutCount(layoutCount)
+	{
+	}
+
+	~VM_JFRMetadataReader()
+	{
+		j9mem_free_memory((void *)_strings);
+		j9mem_free_memory(_stringData);
+	}
+
+	/**
+	 * Look up the type ID of every layout. IDs of types which are missing or
+	 * whose fields differ are left unchanged.
+	 *
+	 * @return true if the whole blob was read, false if it is malformed
+	 */
+	bool
+	resolveTypeIDs()
+	{
+		if (_ok && readStringPool()) {
+			readElement(0, NULL);
+		}
+		return _ok;
+	}
+};
+
+#endif /* defined(J9VM_OPT_JFR) */
+
+#endif /* JFRMETADATAREADER_HPP_ */
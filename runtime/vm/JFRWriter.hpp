@@ -32,6 +32,7 @@
 #if defined(J9VM_OPT_JFR)
 
 #include "JFRChunkWriter.hpp"
+#include "JFRMetadataReader.hpp"
 
 #undef DEBUG
 
@@ -107,6 +108,7 @@ private:
 		}
 
 		j9file_close(fileDescriptor);
+		lookupMetadataTypeIDs(vm);
 		result = true;
 
 done:
@@ -115,6 +117,57 @@ done:
 	}
 
 
+	/**
+	 * Look up the IDs of the event types whose IDs are not fixed in MetadataTypeID.
+	 * An event type which is missing from the metadata blob, or whose fields do
+	 * not match what the chunk writer produces, keeps ID 0 and is not recorded.
+	 */
+	static void
+	lookupMetadataTypeIDs(J9JavaVM *vm)
+	{
+		static const char * const objectAllocationSampleFields[] = {
+			"startTime", "eventThread", "stackTrace", "objectClass", "weight", NULL
+		};
+		static const char * const gcPhasePauseFields[] = {
+			"startTime", "duration", "eventThread", "gcId", "name", NULL
+		};
+		static const char * const compilationFields[] = {
+			"startTime", "duration", "eventThread", "compileId", "method", "compileLevel",
+			"succeded", "isOsr", "codeSize", "inlinedBytes", NULL
+		};
+		static const char * const compilationWithCompilerFields[] = {
+			"startTime", "duration", "eventThread", "compileId", "compiler", "method", "compileLevel",
+			"succeded", "isOsr", "codeSize", "inlinedBytes", NULL
+		};
+		static const char * const compilerTypeFields[] = {
+			"compiler", NULL
+		};
+		JFRState *jfrState = &vm->jfrState;
+		JFRMetadataTypeLayout layouts[] = {
+			{ "jdk.ObjectAllocationSample", objectAllocationSampleFields, &jfrState->objectAllocationSampleTypeID },
+			{ "jdk.GCPhasePause", gcPhasePauseFields, &jfrState->gcPhasePauseTypeID },
+			{ "jdk.Compilation", compilationFields, &jfrState->compilationTypeID },
+			{ "jdk.Compilation", compilationWithCompilerFields, &jfrState->compilationWithCompilerTypeID },
+			{ "jdk.types.CompilerType", compilerTypeFields, &jfrState->compilerTypeTypeID },
+		};
+
+		for (UDATA i = 0; i < (sizeof(layouts) / sizeof(layouts[0])); i++) {
+			*layouts[i].typeID = 0;
+		}
+
+		VM_JFRMetadataReader reader(vm, jfrState->metaDataBlobFile, jfrState->metaDataBlobFileSize, layouts, sizeof(layouts) / sizeof(layouts[0]));
+		if (!reader.resolveTypeIDs()) {
+			for (UDATA i = 0; i < (sizeof(layouts) / sizeof(layouts[0])); i++) {
+				*layouts[i].typeID = 0;
+			}
+		}
+		/* The compiler field refers to a constant pool which can only be written if its type is known. */
+		if (0 == jfrState->compilerTypeTypeID) {
+			jfrState->compilationWithCompilerTypeID = 0;
+		}
+		Trc_VM_jfr_lookupMetadataTypeIDs(jfrState->objectAllocationSampleTypeID, jfrState->gcPhasePauseTypeID, jfrState->compilationTypeID, jfrState->compilationWithCompilerTypeID);
+	}
+
 protected:
 
 public:
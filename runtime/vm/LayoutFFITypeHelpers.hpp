@@ -31,6 +31,40 @@
 
 #define J9VM_LAYOUT_STRING_ON_STACK_LIMIT 128
 
+#if JAVA_SPEC_VERSION >= 16
+/* Direct callouts bypass ffi_call() for signatures whose arguments are all passed in
+ * general purpose registers, in which case the native function is invoked through a
+ * precompiled C call stub with the matching arity instead of the libffi marshaller.
+ * They are only enabled on the 64-bit little-endian platforms where every integer
+ * or pointer argument occupies a full register regardless of its declared width.
+ */
+#if defined(J9VM_ENV_DATA64) && defined(J9VM_ENV_LITTLE_ENDIAN) && (defined(J9VM_ARCH_X86) || defined(J9VM_ARCH_AARCH64))
+#define J9VM_FFI_DIRECT_CALLOUT
+#if defined(J9VM_ARCH_AARCH64)
+#define J9VM_FFI_DIRECT_CALLOUT_MAX_ARGS 8
+#elif defined(WIN32) /* defined(J9VM_ARCH_AARCH64) */
+#define J9VM_FFI_DIRECT_CALLOUT_MAX_ARGS 4
+#else /* defined(J9VM_ARCH_AARCH64) */
+#define J9VM_FFI_DIRECT_CALLOUT_MAX_ARGS 6
+#endif /* defined(J9VM_ARCH_AARCH64) */
+#endif /* defined(J9VM_ENV_DATA64) && defined(J9VM_ENV_LITTLE_ENDIAN) && (defined(J9VM_ARCH_X86) || defined(J9VM_ARCH_AARCH64)) */
+
+/* Values for J9FFICalloutData.directCalloutType */
+#define J9_FFI_DIRECT_CALLOUT_NONE 0
+#define J9_FFI_DIRECT_CALLOUT_RETURN_INTEGRAL 1
+#define J9_FFI_DIRECT_CALLOUT_RETURN_FLOAT 2
+#define J9_FFI_DIRECT_CALLOUT_RETURN_DOUBLE 3
+
+/* The element type of vm->cifNativeCalloutDataCache. The ffi_cif must remain the first
+ * field as the address of the element is handed to java as the calloutThunk and read
+ * back as a ffi_cif pointer.
+ */
+typedef struct J9FFICalloutData {
+	ffi_cif cif;
+	U_8 directCalloutType;
+} J9FFICalloutData;
+#endif /* JAVA_SPEC_VERSION >= 16 */
+
 class LayoutFFITypeHelpers
 {
 #if JAVA_SPEC_VERSION >= 16
@@ -175,6 +209,54 @@ public:
 		return typeCode;
 	}
 
+	/**
+	 * @brief Determine whether the prepared cif can be called through a direct callout stub,
+	 * which is only the case for a non-variadic signature with at most J9VM_FFI_DIRECT_CALLOUT_MAX_ARGS
+	 * integral/pointer arguments and a return type other than a struct.
+	 *
+	 * @param cif[in] The pointer to the prepared ffi_cif
+	 * @param isVarArgs[in] true if the cif was prepared for a variadic function
+	 * @return One of the J9_FFI_DIRECT_CALLOUT_* values
+	 */
+	static VMINLINE U_8
+	getDirectCalloutType(ffi_cif *cif, bool isVarArgs)
+	{
+		U_8 calloutType = J9_FFI_DIRECT_CALLOUT_NONE;
+#if defined(J9VM_FFI_DIRECT_CALLOUT)
+		if (!isVarArgs
+			&& (FFI_DEFAULT_ABI == cif->abi)
+			&& (cif->nargs <= J9VM_FFI_DIRECT_CALLOUT_MAX_ARGS)
+		) {
+			switch (getJ9NativeTypeCodeFromFFIType(cif->rtype)) {
+			case J9NtcFloat:
+				calloutType = J9_FFI_DIRECT_CALLOUT_RETURN_FLOAT;
+				break;
+			case J9NtcDouble:
+				calloutType = J9_FFI_DIRECT_CALLOUT_RETURN_DOUBLE;
+				break;
+			case J9NtcStruct:
+				break;
+			default:
+				calloutType = J9_FFI_DIRECT_CALLOUT_RETURN_INTEGRAL;
+				break;
+			}
+
+			for (U_32 argIndex = 0; (J9_FFI_DIRECT_CALLOUT_NONE != calloutType) && (argIndex < cif->nargs); argIndex++) {
+				switch (getJ9NativeTypeCodeFromFFIType(cif->arg_types[argIndex])) {
+				case J9NtcFloat:
+				case J9NtcDouble:
+				case J9NtcStruct:
+					calloutType = J9_FFI_DIRECT_CALLOUT_NONE;
+					break;
+				default:
+					break;
+				}
+			}
+		}
+#endif /* defined(J9VM_FFI_DIRECT_CALLOUT) */
+		return calloutType;
+	}
+
 	/**
 	 * @brief Obtain the ffi_type from the layout symbol (the preceding letter of the layout type. e.g. I for INT).
 	 *
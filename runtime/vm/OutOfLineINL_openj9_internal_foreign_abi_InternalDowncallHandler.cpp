@@ -162,7 +162,7 @@ OutOfLineINL_openj9_internal_foreign_abi_InternalDowncallHandler_initCifNativeTh
 	}
 
 	if (NULL == vm->cifNativeCalloutDataCache) {
-		vm->cifNativeCalloutDataCache = pool_new(sizeof(ffi_cif), 0, 0, 0, J9_GET_CALLSITE(), J9MEM_CATEGORY_VM_FFI, POOL_FOR_PORT(PORTLIB));
+		vm->cifNativeCalloutDataCache = pool_new(sizeof(J9FFICalloutData), 0, 0, 0, J9_GET_CALLSITE(), J9MEM_CATEGORY_VM_FFI, POOL_FOR_PORT(PORTLIB));
 		if (NULL == vm->cifNativeCalloutDataCache) {
 			rc = GOTO_THROW_CURRENT_EXCEPTION;
 			setNativeOutOfMemoryError(currentThread, 0, 0);
@@ -192,6 +192,8 @@ OutOfLineINL_openj9_internal_foreign_abi_InternalDowncallHandler_initCifNativeTh
 		setCurrentException(currentThread, J9VMCONSTANTPOOL_JAVALANGINTERNALERROR, NULL);
 		goto freeAllMemoryThenExit;
 	}
+	/* Record whether the signature qualifies for a direct callout so as to skip ffi_call in invokeNative. */
+	((J9FFICalloutData *)cif)->directCalloutType = LayoutFFITypeHelpers::getDirectCalloutType(cif, (varArgIndex >= 0));
 
 	if (newArgTypes) {
 		if (NULL == vm->cifArgumentTypesCache) {
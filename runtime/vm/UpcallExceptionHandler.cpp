@@ -24,9 +24,67 @@
 #include "vm_internal.h"
 #if JAVA_SPEC_VERSION >= 16
 #include "ffi.h"
+#include "LayoutFFITypeHelpers.hpp"
 #include <setjmp.h>
 #endif /* JAVA_SPEC_VERSION >= 16 */
 
+#if defined(J9VM_FFI_DIRECT_CALLOUT)
+/**
+ * @brief Invoke the native function through a C call stub with the same arity,
+ * letting the C compiler rather than libffi place the arguments in registers.
+ *
+ * @param function[in] The pointer to the native function address
+ * @param argCount[in] The number of arguments
+ * @param args[in] The arguments, each of which is widened to a 64-bit slot
+ * @return The return value of the native function
+ */
+template <typename ReturnType>
+static VMINLINE ReturnType
+directCallout(void *function, U_32 argCount, U_64 *args)
+{
+	ReturnType result = 0;
+
+	switch (argCount) {
+	case 0:
+		result = ((ReturnType (*)(void))function)();
+		break;
+	case 1:
+		result = ((ReturnType (*)(U_64))function)(args[0]);
+		break;
+	case 2:
+		result = ((ReturnType (*)(U_64, U_64))function)(args[0], args[1]);
+		break;
+	case 3:
+		result = ((ReturnType (*)(U_64, U_64, U_64))function)(args[0], args[1], args[2]);
+		break;
+	case 4:
+		result = ((ReturnType (*)(U_64, U_64, U_64, U_64))function)(args[0], args[1], args[2], args[3]);
+		break;
+#if J9VM_FFI_DIRECT_CALLOUT_MAX_ARGS > 4
+	case 5:
+		result = ((ReturnType (*)(U_64, U_64, U_64, U_64, U_64))function)(args[0], args[1], args[2], args[3], args[4]);
+		break;
+	case 6:
+		result = ((ReturnType (*)(U_64, U_64, U_64, U_64, U_64, U_64))function)(args[0], args[1], args[2], args[3], args[4], args[5]);
+		break;
+#endif /* J9VM_FFI_DIRECT_CALLOUT_MAX_ARGS > 4 */
+#if J9VM_FFI_DIRECT_CALLOUT_MAX_ARGS > 6
+	case 7:
+		result = ((ReturnType (*)(U_64, U_64, U_64, U_64, U_64, U_64, U_64))function)(args[0], args[1], args[2], args[3], args[4], args[5], args[6]);
+		break;
+	case 8:
+		result = ((ReturnType (*)(U_64, U_64, U_64, U_64, U_64, U_64, U_64, U_64))function)(args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]);
+		break;
+#endif /* J9VM_FFI_DIRECT_CALLOUT_MAX_ARGS > 6 */
+	default:
+		Assert_VM_unreachable();
+		break;
+	}
+
+	return result;
+}
+#endif /* defined(J9VM_FFI_DIRECT_CALLOUT) */
+
 extern "C" {
 
 #if JAVA_SPEC_VERSION >= 16
@@ -76,6 +134,70 @@ ffiCallWithSetJmpForUpcall(J9VMThread *currentThread, ffi_cif *cif, void *functi
 	currentThread->jmpBufEnvPtr = jmpBufEnvPtr;
 }
 
+#if defined(J9VM_FFI_DIRECT_CALLOUT)
+/**
+ * @brief The counterpart of ffiCallWithSetJmpForUpcall() for the signatures qualified
+ * for the direct callout, in which case ffi_call is bypassed.
+ *
+ * The return value is stored in the same format as ffi_call does so that it
+ * can be converted by convertFFIReturnValue() afterwards.
+ *
+ * @param currentThread[in] The pointer to the current J9VMThread
+ * @param calloutData[in] The pointer to the cif with the direct callout type
+ * @param function[in] The pointer to the native function address
+ * @param returnStorage[in] The pointer to the return value
+ * @param args[in] The arguments, each of which is widened to a 64-bit slot
+ */
+void
+ffiDirectCallWithSetJmpForUpcall(J9VMThread *currentThread, J9FFICalloutData *calloutData, void *function, UDATA *returnStorage, U_64 *args)
+{
+	jmp_buf jmpBufferEnv = {};
+	void *jmpBufEnvPtr = currentThread->jmpBufEnvPtr;
+	U_32 argCount = calloutData->cif.nargs;
+
+	currentThread->jmpBufEnvPtr = (void *)&jmpBufferEnv;
+
+	if (!setjmp(jmpBufferEnv)) {
+		switch (calloutData->directCalloutType) {
+		case J9_FFI_DIRECT_CALLOUT_RETURN_FLOAT:
+			*(float *)returnStorage = directCallout<float>(function, argCount, args);
+			break;
+		case J9_FFI_DIRECT_CALLOUT_RETURN_DOUBLE:
+			*(double *)returnStorage = directCallout<double>(function, argCount, args);
+			break;
+		default: {
+			UDATA result = directCallout<UDATA>(function, argCount, args);
+			/* The upper bits of a narrow return register are undefined, so widen
+			 * the value to a full slot as ffi_call does.
+			 */
+			switch (calloutData->cif.rtype->type) {
+			case FFI_TYPE_UINT8:
+				result = (UDATA)(U_8)result;
+				break;
+			case FFI_TYPE_SINT8:
+				result = (UDATA)(IDATA)(I_8)result;
+				break;
+			case FFI_TYPE_UINT16:
+				result = (UDATA)(U_16)result;
+				break;
+			case FFI_TYPE_SINT16:
+				result = (UDATA)(IDATA)(I_16)result;
+				break;
+			case FFI_TYPE_SINT32:
+				result = (UDATA)(IDATA)(I_32)result;
+				break;
+			default:
+				break;
+			}
+			*returnStorage = result;
+			break;
+		}
+		}
+	}
+	currentThread->jmpBufEnvPtr = jmpBufEnvPtr;
+}
+#endif /* defined(J9VM_FFI_DIRECT_CALLOUT) */
+
 /**
  * @brief This function serves as a wrapper of longjmp that restore back to
  * the call site with all registered saved via setjmp whenever an exception
@@ -21,6 +21,9 @@
  *******************************************************************************/
 #include "JFRConstantPoolTypes.hpp"
 #include "j9protos.h"
+#include "jithook.h"
+#include "mmhook.h"
+#include "mmomrhook.h"
 #include "omrlinkedlist.h"
 #include "pool_api.h"
 #include "thread_api.h"
@@ -31,6 +34,7 @@
 
 #include "AtomicSupport.hpp"
 #include "JFRWriter.hpp"
+#include "VMHelpers.hpp"
 
 extern "C" {
 
@@ -44,7 +48,18 @@ typedef struct J9JFRTypeID {
 // TODO: allow configureable values
 #define J9JFR_THREAD_BUFFER_SIZE (1024*1024)
 #define J9JFR_GLOBAL_BUFFER_SIZE (10 * J9JFR_THREAD_BUFFER_SIZE)
+/* Upper bound on the bytes of full thread buffers waiting for the writer thread */
+#define J9JFR_MAX_QUEUED_BYTES J9JFR_GLOBAL_BUFFER_SIZE
 #define J9JFR_SAMPLING_RATE 10
+/* Upper bounds on the number of threads sampled in each sampling period */
+#define J9JFR_SAMPLER_MAX_JAVA_THREADS 5
+#define J9JFR_SAMPLER_MAX_NATIVE_THREADS 1
+/* Percentage of a sampling period the sampler thread may spend sampling before it lengthens the period */
+#define J9JFR_SAMPLER_CPU_BUDGET_PERCENT 2
+#define J9JFR_STATISTICS_PERIOD_NANOS ((I_64)1000 * 1000 * 1000)
+#define J9JFR_THREAD_CPU_LOAD_PERIOD_NANOS (10 * J9JFR_STATISTICS_PERIOD_NANOS)
+/* Bytes allocated by a thread between object allocation samples, the same default as the JVMTI SampledObjectAlloc event */
+#define J9JFR_ALLOCATION_SAMPLING_INTERVAL (512 * 1024)
 
 /* Value needs to be the same as jdk.jfr.internal.JVM.RESERVED_CLASS_ID_LIMIT. */
 #define RESERVED_CLASS_ID_LIMIT 500
@@ -61,10 +76,13 @@ typedef struct J9JFRTypeID {
 #define STACKTRACE_TYPE_ID 9
 
 static void jfrStartSamplingThread(J9JavaVM *vm);
+static void jfrStartWriterThread(J9JavaVM *vm);
 static void initializeEventFields(J9VMThread *currentThread, J9JFREvent *jfrEvent, UDATA eventType);
 static int J9THREAD_PROC jfrSamplingThreadProc(void *entryArg);
+static int J9THREAD_PROC jfrWriterThreadProc(void *entryArg);
 static void jfrExecutionSampleCallback(J9VMThread *currentThread, IDATA handlerKey, void *userData);
 static void jfrThreadCPULoadCallback(J9VMThread *currentThread, IDATA handlerKey, void *userData);
+static void jfrHookRuntimeEvents(J9VMThread *currentThread);
 
 /**
  * Calculate the size in bytes of a JFR event.
@@ -79,6 +97,7 @@ jfrEventSize(J9JFREvent *jfrEvent)
 	UDATA size = 0;
 	switch(jfrEvent->eventType) {
 	case J9JFR_EVENT_TYPE_EXECUTION_SAMPLE:
+	case J9JFR_EVENT_TYPE_NATIVE_METHOD_SAMPLE:
 		size = sizeof(J9JFRExecutionSample) + (((J9JFRExecutionSample*)jfrEvent)->stackTraceSize * sizeof(UDATA));
 		break;
 	case J9JFR_EVENT_TYPE_THREAD_START:
@@ -117,6 +136,15 @@ jfrEventSize(J9JFREvent *jfrEvent)
 	case J9JFR_EVENT_TYPE_SYSTEM_GC:
 		size = sizeof(J9JFRSystemGC) + (((J9JFRSystemGC *)jfrEvent)->stackTraceSize * sizeof(UDATA));
 		break;
+	case J9JFR_EVENT_TYPE_OBJECT_ALLOCATION_SAMPLE:
+		size = sizeof(J9JFRObjectAllocationSample) + (((J9JFRObjectAllocationSample *)jfrEvent)->stackTraceSize * sizeof(UDATA));
+		break;
+	case J9JFR_EVENT_TYPE_GC_PHASE_PAUSE:
+		size = sizeof(J9JFRGCPhasePause);
+		break;
+	case J9JFR_EVENT_TYPE_COMPILATION:
+		size = sizeof(J9JFRCompilation);
+		break;
 	default:
 		Assert_VM_unreachable();
 		break;
@@ -205,6 +233,37 @@ writeOutGlobalBuffer(J9VMThread *currentThread, bool finalWrite, bool dumpCalled
 	return true;
 }
 
+/**
+ * Append event data to the global buffer, writing out the global buffer first
+ * if there is not enough room.
+ *
+ * @param currentThread[in] the current J9VMThread
+ * @param data[in] the event data
+ * @param size[in] the number of bytes of event data
+ *
+ * @returns true on success, false on failure
+ */
+static bool
+copyToGlobalBuffer(J9VMThread *currentThread, U_8 *data, UDATA size)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	bool success = true;
+
+	omrthread_monitor_enter(vm->jfrBufferMutex);
+	if (vm->jfrBuffer.bufferRemaining < size) {
+		if (!writeOutGlobalBuffer(currentThread, false, false)) {
+			success = false;
+			goto done;
+		}
+	}
+	memcpy(vm->jfrBuffer.bufferCurrent, data, size);
+	vm->jfrBuffer.bufferCurrent += size;
+	vm->jfrBuffer.bufferRemaining -= size;
+done:
+	omrthread_monitor_exit(vm->jfrBufferMutex);
+	return success;
+}
+
 /**
  * Flush a thread local buffer to the global buffer.
  *
@@ -219,7 +278,6 @@ writeOutGlobalBuffer(J9VMThread *currentThread, bool finalWrite, bool dumpCalled
 static bool
 flushBufferToGlobal(J9VMThread *currentThread, J9VMThread *flushThread)
 {
-	J9JavaVM *vm = currentThread->javaVM;
 	UDATA bufferSize = flushThread->jfrBuffer.bufferCurrent - flushThread->jfrBuffer.bufferStart;
 	bool success = true;
 
@@ -232,18 +290,10 @@ flushBufferToGlobal(J9VMThread *currentThread, J9VMThread *flushThread)
 	j9tty_printf(PORTLIB, "\n!!! flushing %p of size %u start=%p current=%p\n", flushThread, (U_32)bufferSize, flushThread->jfrBuffer.bufferStart, flushThread->jfrBuffer.bufferCurrent);
 #endif /* defined(DEBUG) */
 
-	omrthread_monitor_enter(vm->jfrBufferMutex);
-	if (vm->jfrBuffer.bufferRemaining < bufferSize) {
-		if (!writeOutGlobalBuffer(currentThread, false, false)) {
-			omrthread_monitor_exit(vm->jfrBufferMutex);
-			success = false;
-			goto done;
-		}
+	if (!copyToGlobalBuffer(currentThread, flushThread->jfrBuffer.bufferStart, bufferSize)) {
+		success = false;
+		goto done;
 	}
-	memcpy(vm->jfrBuffer.bufferCurrent, flushThread->jfrBuffer.bufferStart, bufferSize);
-	vm->jfrBuffer.bufferCurrent += bufferSize;
-	vm->jfrBuffer.bufferRemaining -= bufferSize;
-	omrthread_monitor_exit(vm->jfrBufferMutex);
 
 	/* Reset the buffer */
 	flushThread->jfrBuffer.bufferRemaining = flushThread->jfrBuffer.bufferSize;
@@ -257,6 +307,122 @@ done:
 	return success;
 }
 
+/**
+ * Hand the full local buffer of the current thread to the writer thread and give
+ * the thread an empty buffer, so that the thread does not wait for a chunk to be
+ * written.
+ *
+ * @param currentThread[in] the current J9VMThread
+ *
+ * @returns true if the buffer was queued, false if it must be flushed to the global buffer instead
+ */
+static bool
+queueThreadBuffer(J9VMThread *currentThread)
+{
+	PORT_ACCESS_FROM_VMC(currentThread);
+	J9JavaVM *vm = currentThread->javaVM;
+	UDATA bufferSize = currentThread->jfrBuffer.bufferCurrent - currentThread->jfrBuffer.bufferStart;
+	J9JFRQueuedBuffer *queued = NULL;
+	J9JFRQueuedBuffer *head = NULL;
+	U_8 *buffer = NULL;
+	bool success = false;
+
+	if (J9JFR_WRITER_STATE_RUNNING != vm->jfrWriterState) {
+		goto done;
+	}
+
+	/* Fall back to flushing on this thread if the writer thread is too far behind */
+	if ((vm->jfrQueuedBytes + bufferSize) > J9JFR_MAX_QUEUED_BYTES) {
+		goto done;
+	}
+
+	queued = (J9JFRQueuedBuffer *)j9mem_allocate_memory(sizeof(J9JFRQueuedBuffer), J9MEM_CATEGORY_JFR);
+	if (NULL == queued) {
+		goto done;
+	}
+	buffer = (U_8 *)j9mem_allocate_memory(J9JFR_THREAD_BUFFER_SIZE, J9MEM_CATEGORY_JFR);
+	if (NULL == buffer) {
+		j9mem_free_memory(queued);
+		goto done;
+	}
+
+#if defined(DEBUG)
+	j9tty_printf(PORTLIB, "\n!!! queueing %p of size %u\n", currentThread, (U_32)bufferSize);
+	memset(buffer, 0, J9JFR_THREAD_BUFFER_SIZE);
+#endif /* defined(DEBUG) */
+
+	queued->bufferStart = currentThread->jfrBuffer.bufferStart;
+	queued->bufferSize = bufferSize;
+	VM_AtomicSupport::add(&vm->jfrQueuedBytes, bufferSize);
+	do {
+		head = vm->jfrQueuedBuffers;
+		queued->next = head;
+	} while ((UDATA)head != VM_AtomicSupport::lockCompareExchange((volatile UDATA *)&vm->jfrQueuedBuffers, (UDATA)head, (UDATA)queued));
+
+	currentThread->jfrBuffer.bufferStart = buffer;
+	currentThread->jfrBuffer.bufferCurrent = buffer;
+	currentThread->jfrBuffer.bufferSize = J9JFR_THREAD_BUFFER_SIZE;
+	currentThread->jfrBuffer.bufferRemaining = J9JFR_THREAD_BUFFER_SIZE;
+
+	/* The writer thread only waits while the queue is empty */
+	if (NULL == head) {
+		omrthread_monitor_enter(vm->jfrWriterMutex);
+		omrthread_monitor_notify(vm->jfrWriterMutex);
+		omrthread_monitor_exit(vm->jfrWriterMutex);
+	}
+	success = true;
+
+done:
+	return success;
+}
+
+/**
+ * Copy all queued thread buffers to the global buffer, oldest first, and free them.
+ *
+ * The current thread must have VM access, which keeps the writer thread and a
+ * thread with exclusive VM access from draining the queue at the same time.
+ *
+ * @param currentThread[in] the current J9VMThread
+ *
+ * @returns true if all buffers were copied successfully, false if not
+ */
+static bool
+drainQueuedBuffers(J9VMThread *currentThread)
+{
+	PORT_ACCESS_FROM_VMC(currentThread);
+	J9JavaVM *vm = currentThread->javaVM;
+	J9JFRQueuedBuffer *queued = NULL;
+	J9JFRQueuedBuffer *ordered = NULL;
+	bool allSucceeded = true;
+
+	/* Detach the whole stack, then reverse it to recover the order the buffers were queued in */
+	do {
+		queued = vm->jfrQueuedBuffers;
+	} while ((UDATA)queued != VM_AtomicSupport::lockCompareExchange((volatile UDATA *)&vm->jfrQueuedBuffers, (UDATA)queued, (UDATA)NULL));
+
+	while (NULL != queued) {
+		J9JFRQueuedBuffer *next = queued->next;
+		queued->next = ordered;
+		ordered = queued;
+		queued = next;
+	}
+
+	while (NULL != ordered) {
+		J9JFRQueuedBuffer *next = ordered->next;
+		if (vm->jfrState.isStarted && (NULL != vm->jfrBuffer.bufferCurrent)) {
+			if (!copyToGlobalBuffer(currentThread, ordered->bufferStart, ordered->bufferSize)) {
+				allSucceeded = false;
+			}
+		}
+		VM_AtomicSupport::subtract(&vm->jfrQueuedBytes, ordered->bufferSize);
+		j9mem_free_memory(ordered->bufferStart);
+		j9mem_free_memory(ordered);
+		ordered = next;
+	}
+
+	return allSucceeded;
+}
+
 /**
  * Flush all thread local buffers to the global buffer.
  *
@@ -280,6 +446,11 @@ flushAllThreadBuffers(J9VMThread *currentThread, bool freeBuffers)
 	Assert_VM_true(currentThread->omrVMThread->exclusiveCount > 0);
 	Assert_VM_true((J9_XACCESS_EXCLUSIVE == vm->exclusiveAccessState) || (J9_XACCESS_EXCLUSIVE == vm->safePointState));
 
+	/* Queued buffers hold older events than the thread local buffers */
+	if (!drainQueuedBuffers(currentThread)) {
+		allSucceeded = false;
+	}
+
 	do {
 		if (!flushBufferToGlobal(currentThread, loopThread)) {
 			allSucceeded = false;
@@ -334,9 +505,11 @@ reserveBuffer(J9VMThread *currentThread, UDATA size)
 
 	/* If the event is larger than the buffer, fail without attemptiong to flush */
 	if (size <= currentThread->jfrBuffer.bufferSize) {
-		/* If there isn't enough space, flush the thread buffer to global */
+		/* If there isn't enough space, queue the thread buffer for the writer thread or flush it to global */
 		if (size > currentThread->jfrBuffer.bufferRemaining) {
-			if (!flushBufferToGlobal(currentThread, currentThread)) {
+			if (!queueThreadBuffer(currentThread)
+			&& !flushBufferToGlobal(currentThread, currentThread)
+			) {
 				goto done;
 			}
 		}
@@ -349,17 +522,19 @@ done:
 }
 
 /**
- * Reserve space for an event, initialize the common fields
- * and attach the stack trace.
+ * Reserve space for an event in the buffer of a given thread, initialize
+ * the common fields and attach the stack trace of the sample thread.
  *
  * @param currentThread[in] the current J9VMThread
+ * @param sampleThread[in] the J9VMThread the event is for
+ * @param bufferThread[in] the J9VMThread whose buffer receives the event
  * @param eventType[in] the event type
  * @param eventFixedSize[in] size of the fixed portion of the event
  *
  * @returns pointer to the start of the reserved space or NULL if the space could not be reserved
  */
 static J9JFREvent*
-reserveBufferWithStackTrace(J9VMThread *currentThread, J9VMThread *sampleThread, UDATA eventType, UDATA eventFixedSize)
+reserveThreadBufferWithStackTrace(J9VMThread *currentThread, J9VMThread *sampleThread, J9VMThread *bufferThread, UDATA eventType, UDATA eventFixedSize)
 {
 	J9JFREvent *jfrEvent = NULL;
 	J9StackWalkState *walkState = currentThread->stackWalkState;
@@ -372,7 +547,7 @@ reserveBufferWithStackTrace(J9VMThread *currentThread, J9VMThread *sampleThread,
 		UDATA framesWalked = walkState->framesWalked;
 		UDATA stackTraceBytes = framesWalked * sizeof(UDATA);
 		UDATA eventSize = eventFixedSize + stackTraceBytes;
-		jfrEvent = (J9JFREvent*)reserveBuffer(sampleThread, eventSize);
+		jfrEvent = (J9JFREvent*)reserveBuffer(bufferThread, eventSize);
 		if (NULL != jfrEvent) {
 			initializeEventFields(sampleThread, jfrEvent, eventType);
 			((J9JFREventWithStackTrace*)jfrEvent)->stackTraceSize = framesWalked;
@@ -386,6 +561,23 @@ reserveBufferWithStackTrace(J9VMThread *currentThread, J9VMThread *sampleThread,
 	return jfrEvent;
 }
 
+/**
+ * Reserve space for an event in the buffer of the sample thread, initialize
+ * the common fields and attach the stack trace.
+ *
+ * @param currentThread[in] the current J9VMThread
+ * @param sampleThread[in] the J9VMThread the event is for
+ * @param eventType[in] the event type
+ * @param eventFixedSize[in] size of the fixed portion of the event
+ *
+ * @returns pointer to the start of the reserved space or NULL if the space could not be reserved
+ */
+static J9JFREvent*
+reserveBufferWithStackTrace(J9VMThread *currentThread, J9VMThread *sampleThread, UDATA eventType, UDATA eventFixedSize)
+{
+	return reserveThreadBufferWithStackTrace(currentThread, sampleThread, sampleThread, eventType, eventFixedSize);
+}
+
 /**
  * Hook for new thread being created.
  *
@@ -602,6 +794,8 @@ jfrVMInitialized(J9HookInterface **hook, UDATA eventNum, void *eventData, void *
 	PORT_ACCESS_FROM_VMC(currentThread);
 	j9tty_printf(PORTLIB, "\n!!! VM init %p\n", currentThread);
 #endif /* defined(DEBUG) */
+	jfrHookRuntimeEvents(currentThread);
+	jfrStartWriterThread(currentThread->javaVM);
 	jfrStartSamplingThread(currentThread->javaVM);
 }
 
@@ -627,6 +821,27 @@ jfrStartSamplingThread(J9JavaVM *vm)
 	}
 }
 
+/**
+ * Start JFR writer thread. Called without VM access.
+ *
+ * @param vm[in] pointer to the J9JavaVM
+ */
+static void
+jfrStartWriterThread(J9JavaVM *vm)
+{
+	IDATA rc = omrthread_create(&(vm->jfrWriterThread), vm->defaultOSStackSize, J9THREAD_PRIORITY_NORMAL, FALSE, jfrWriterThreadProc, (void*)vm);
+	if (0 == rc) {
+		omrthread_monitor_enter(vm->jfrWriterMutex);
+		while (J9JFR_WRITER_STATE_UNINITIALIZED == vm->jfrWriterState) {
+			omrthread_monitor_wait(vm->jfrWriterMutex);
+		}
+		omrthread_monitor_exit(vm->jfrWriterMutex);
+		Trc_VM_jfrStartWriterThread_jfrWriterState(vm->jfrWriterState);
+	} else {
+		Trc_VM_jfrStartWriterThread_omrthread_create_failed(rc);
+	}
+}
+
 /**
  * Hook for VM monitor waited. Called without VM access.
  *
@@ -739,6 +954,170 @@ jfrSystemGC(J9HookInterface **hook, UDATA eventNum, void *eventData, void* userD
 	}
 }
 
+/**
+ * Hook for a sampled object allocation, driven by the TLH refresh when the
+ * allocation sampling interval is reached. Called with VM access.
+ *
+ * @param hook[in] the GC hook interface
+ * @param eventNum[in] the event number
+ * @param eventData[in] the event data
+ * @param userData[in] the registered user data
+ */
+static void
+jfrObjectAllocationSample(J9HookInterface **hook, UDATA eventNum, void *eventData, void* userData)
+{
+	MM_ObjectAllocationSamplingEvent *event = (MM_ObjectAllocationSamplingEvent *)eventData;
+	J9VMThread *currentThread = event->currentThread;
+
+	J9JavaVM *vm = currentThread->javaVM;
+
+	if (0 != vm->jfrState.objectAllocationSampleTypeID) {
+		J9JFRObjectAllocationSample *jfrEvent = (J9JFRObjectAllocationSample *)reserveBufferWithStackTrace(currentThread, currentThread, J9JFR_EVENT_TYPE_OBJECT_ALLOCATION_SAMPLE, sizeof(*jfrEvent));
+		if (NULL != jfrEvent) {
+			jfrEvent->objectClass = event->clazz;
+			/* Each sample stands for the bytes allocated since the previous one. A JVMTI agent may have set the interval. */
+			jfrEvent->weight = OMR_MAX(event->objectSize, vm->memoryManagerFunctions->j9gc_get_allocation_sampling_interval(vm));
+		}
+	}
+}
+
+/**
+ * Hook for the start of a stop-the-world collection. Called with exclusive VM access.
+ *
+ * @param hook[in] the OMR GC hook interface
+ * @param eventNum[in] the event number
+ * @param eventData[in] the event data
+ * @param userData[in] the registered user data
+ */
+static void
+jfrGCStart(J9HookInterface **hook, UDATA eventNum, void *eventData, void* userData)
+{
+	/* All GC start/end events have currentThread in the same position */
+	J9VMThread *currentThread = (J9VMThread *)((MM_GlobalGCStartEvent *)eventData)->currentThread->_language_vmthread;
+	PORT_ACCESS_FROM_VMC(currentThread);
+
+	currentThread->javaVM->jfrState.gcStartTicks = j9time_nano_time();
+}
+
+/**
+ * Hook for the end of a stop-the-world collection. Called with exclusive VM access.
+ *
+ * @param hook[in] the OMR GC hook interface
+ * @param eventNum[in] the event number
+ * @param eventData[in] the event data
+ * @param userData[in] the registered user data
+ */
+static void
+jfrGCEnd(J9HookInterface **hook, UDATA eventNum, void *eventData, void* userData)
+{
+	J9VMThread *currentThread = (J9VMThread *)((MM_GlobalGCEndEvent *)eventData)->currentThread->_language_vmthread;
+	JFRState *jfrState = &currentThread->javaVM->jfrState;
+	PORT_ACCESS_FROM_VMC(currentThread);
+
+	if ((0 != jfrState->gcPhasePauseTypeID) && (0 != jfrState->gcStartTicks)) {
+		J9JFRGCPhasePause *jfrEvent = (J9JFRGCPhasePause *)reserveBuffer(currentThread, sizeof(*jfrEvent));
+		if (NULL != jfrEvent) {
+			initializeEventFields(currentThread, (J9JFREvent *)jfrEvent, J9JFR_EVENT_TYPE_GC_PHASE_PAUSE);
+			jfrEvent->startTicks = jfrState->gcStartTicks;
+			jfrEvent->duration = j9time_nano_time() - jfrState->gcStartTicks;
+			jfrEvent->gcId = jfrState->gcCount;
+			jfrEvent->globalGC = (J9HOOK_MM_OMR_GLOBAL_GC_END == eventNum);
+		}
+	}
+	jfrState->gcStartTicks = 0;
+	jfrState->gcCount += 1;
+}
+
+/**
+ * Hook for the start of a JIT compilation. Called on a compilation thread.
+ *
+ * @param hook[in] the JIT hook interface
+ * @param eventNum[in] the event number
+ * @param eventData[in] the event data
+ * @param userData[in] the registered user data
+ */
+static void
+jfrCompilingStart(J9HookInterface **hook, UDATA eventNum, void *eventData, void* userData)
+{
+	J9VMThread *currentThread = ((J9CompilingStartEvent *)eventData)->currentThread;
+	PORT_ACCESS_FROM_VMC(currentThread);
+
+	currentThread->threadJfrState.compilationStartTicks = j9time_nano_time();
+}
+
+/**
+ * Hook for the end of a JIT compilation. Called on a compilation thread; events
+ * are only recorded when the thread holds VM access, which it does for every
+ * compilation that runs in this VM.
+ *
+ * @param hook[in] the JIT hook interface
+ * @param eventNum[in] the event number
+ * @param eventData[in] the event data
+ * @param userData[in] the registered user data
+ */
+static void
+jfrCompilingEnd(J9HookInterface **hook, UDATA eventNum, void *eventData, void* userData)
+{
+	J9CompilingEndEvent *event = (J9CompilingEndEvent *)eventData;
+	J9VMThread *currentThread = event->currentThread;
+	JFRState *jfrState = &currentThread->javaVM->jfrState;
+	I_64 startTicks = currentThread->threadJfrState.compilationStartTicks;
+	PORT_ACCESS_FROM_VMC(currentThread);
+
+	currentThread->threadJfrState.compilationStartTicks = 0;
+	if (((0 != jfrState->compilationTypeID) || (0 != jfrState->compilationWithCompilerTypeID))
+	&& (0 != startTicks)
+	&& J9_ARE_ANY_BITS_SET(currentThread->publicFlags, J9_PUBLIC_FLAGS_VM_ACCESS)
+	) {
+		J9JFRCompilation *jfrEvent = (J9JFRCompilation *)reserveBuffer(currentThread, sizeof(*jfrEvent));
+		if (NULL != jfrEvent) {
+			initializeEventFields(currentThread, (J9JFREvent *)jfrEvent, J9JFR_EVENT_TYPE_COMPILATION);
+			jfrEvent->startTicks = startTicks;
+			jfrEvent->duration = j9time_nano_time() - startTicks;
+			jfrEvent->method = event->method;
+			jfrEvent->compileId = VM_AtomicSupport::addU32(&jfrState->compilationCount, 1);
+			jfrEvent->compileLevel = (U_16)event->optLevel;
+			jfrEvent->succeeded = (0 != event->succeeded);
+			jfrEvent->isOSR = (0 != event->isOSR);
+			jfrEvent->codeSize = event->codeSize;
+		}
+	}
+}
+
+/**
+ * Register the hooks for event sources which are only available once the VM
+ * has been initialized: the JIT, and allocation sampling which needs a current thread.
+ * The allocation sampling hook must have been reserved before bootstrap, by
+ * initializeJFR() or by a JVMTI agent, as the VM disables it otherwise.
+ *
+ * @param currentThread[in] the current J9VMThread
+ */
+static void
+jfrHookRuntimeEvents(J9VMThread *currentThread)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	J9HookInterface **jitHooks = getJITHookInterface(vm);
+
+	if (0 != vm->jfrState.objectAllocationSampleTypeID) {
+		J9HookInterface **gcHooks = vm->memoryManagerFunctions->j9gc_get_hook_interface(vm);
+		if (0 == (*gcHooks)->J9HookRegisterWithCallSite(gcHooks, J9HOOK_MM_OBJECT_ALLOCATION_SAMPLING, jfrObjectAllocationSample, OMR_GET_CALLSITE(), NULL)) {
+			/* Keep an interval already set by a JVMTI agent. */
+			if (UDATA_MAX == vm->memoryManagerFunctions->j9gc_get_allocation_sampling_interval(vm)) {
+				vm->memoryManagerFunctions->j9gc_set_allocation_sampling_interval(vm, J9JFR_ALLOCATION_SAMPLING_INTERVAL);
+			}
+		} else {
+			Trc_VM_jfrHookRuntimeEvents_allocationSamplingUnavailable(currentThread);
+		}
+	}
+	if ((NULL != jitHooks)
+	&& ((0 != vm->jfrState.compilationTypeID) || (0 != vm->jfrState.compilationWithCompilerTypeID))
+	) {
+		if (0 == (*jitHooks)->J9HookRegisterWithCallSite(jitHooks, J9HOOK_JIT_COMPILING_START, jfrCompilingStart, OMR_GET_CALLSITE(), NULL)) {
+			(*jitHooks)->J9HookRegisterWithCallSite(jitHooks, J9HOOK_JIT_COMPILING_END, jfrCompilingEnd, OMR_GET_CALLSITE(), NULL);
+		}
+	}
+}
+
 jint
 initializeJFR(J9JavaVM *vm, BOOLEAN lateInit)
 {
@@ -746,6 +1125,7 @@ initializeJFR(J9JavaVM *vm, BOOLEAN lateInit)
 	OMRPORT_ACCESS_FROM_J9PORT(PORTLIB);
 	jint rc = JNI_ERR;
 	J9HookInterface **vmHooks = getVMHookInterface(vm);
+	J9HookInterface **gcOmrHooks = vm->memoryManagerFunctions->j9gc_get_omr_hook_interface(vm->omrVM);
 	U_8 *buffer = NULL;
 	UDATA timeSuccess = 0;
 
@@ -800,6 +1180,18 @@ initializeJFR(J9JavaVM *vm, BOOLEAN lateInit)
 	if ((*vmHooks)->J9HookRegisterWithCallSite(vmHooks, J9HOOK_SYSTEM_GC_CALLED, jfrSystemGC, OMR_GET_CALLSITE(), NULL)) {
 		goto fail;
 	}
+	if ((*gcOmrHooks)->J9HookRegisterWithCallSite(gcOmrHooks, J9HOOK_MM_OMR_GLOBAL_GC_START, jfrGCStart, OMR_GET_CALLSITE(), NULL)) {
+		goto fail;
+	}
+	if ((*gcOmrHooks)->J9HookRegisterWithCallSite(gcOmrHooks, J9HOOK_MM_OMR_GLOBAL_GC_END, jfrGCEnd, OMR_GET_CALLSITE(), NULL)) {
+		goto fail;
+	}
+	if ((*gcOmrHooks)->J9HookRegisterWithCallSite(gcOmrHooks, J9HOOK_MM_OMR_LOCAL_GC_START, jfrGCStart, OMR_GET_CALLSITE(), NULL)) {
+		goto fail;
+	}
+	if ((*gcOmrHooks)->J9HookRegisterWithCallSite(gcOmrHooks, J9HOOK_MM_OMR_LOCAL_GC_END, jfrGCEnd, OMR_GET_CALLSITE(), NULL)) {
+		goto fail;
+	}
 
 	/* Allocate constantEvents. */
 	vm->jfrState.constantEvents = j9mem_allocate_memory(sizeof(JFRConstantEvents), J9MEM_CATEGORY_JFR);
@@ -847,6 +1239,9 @@ initializeJFR(J9JavaVM *vm, BOOLEAN lateInit)
 	if (omrthread_monitor_init_with_name(&vm->jfrSamplerMutex, 0, "JFR sampler mutex")) {
 		goto fail;
 	}
+	if (omrthread_monitor_init_with_name(&vm->jfrWriterMutex, 0, "JFR writer mutex")) {
+		goto fail;
+	}
 	if (omrthread_monitor_init_with_name(&vm->jfrState.isConstantEventsInitializedMutex, 0, "Is JFR constantEvents initialized mutex")) {
 		goto fail;
 	}
@@ -855,6 +1250,17 @@ initializeJFR(J9JavaVM *vm, BOOLEAN lateInit)
 		goto fail;
 	}
 
+	/* The VM disables the allocation sampling hook at bootstrap unless it is reserved. Reserving it
+	 * disables safepoint OSR, as it does for the JVMTI SampledObjectAlloc event. The hook is registered
+	 * once the VM is initialized. Without it the other events are still recorded.
+	 */
+	if (!lateInit && (0 != vm->jfrState.objectAllocationSampleTypeID)) {
+		J9HookInterface **gcHooks = vm->memoryManagerFunctions->j9gc_get_hook_interface(vm);
+		if (0 != (*gcHooks)->J9HookReserve(gcHooks, J9HOOK_MM_OBJECT_ALLOCATION_SAMPLING)) {
+			Trc_VM_initializeJFR_reserveAllocationSamplingFailed();
+		}
+	}
+
 	if (lateInit) {
 		/* Go through existing threads. */
 		J9VMThread *walkThread = J9_LINKED_LIST_START_DO(vm->mainThread);
@@ -875,6 +1281,8 @@ initializeJFR(J9JavaVM *vm, BOOLEAN lateInit)
 			walkThread = J9_LINKED_LIST_NEXT_DO(vm->mainThread, walkThread);
 		}
 
+		jfrHookRuntimeEvents(currentVMThread(vm));
+		jfrStartWriterThread(vm);
 		jfrStartSamplingThread(vm);
 	}
 
@@ -893,6 +1301,9 @@ tearDownJFR(J9JavaVM *vm)
 	PORT_ACCESS_FROM_JAVAVM(vm);
 	J9VMThread *currentThread = currentVMThread(vm);
 	J9HookInterface **vmHooks = getVMHookInterface(vm);
+	J9HookInterface **gcHooks = vm->memoryManagerFunctions->j9gc_get_hook_interface(vm);
+	J9HookInterface **gcOmrHooks = vm->memoryManagerFunctions->j9gc_get_omr_hook_interface(vm->omrVM);
+	J9HookInterface **jitHooks = getJITHookInterface(vm);
 
 	Assert_VM_mustHaveVMAccess(currentThread);
 
@@ -913,10 +1324,26 @@ tearDownJFR(J9JavaVM *vm)
 		vm->jfrSamplerMutex = NULL;
 	}
 
+	/* Stop the writer thread */
+	if (NULL != vm->jfrWriterMutex) {
+		omrthread_monitor_enter(vm->jfrWriterMutex);
+		if (J9JFR_WRITER_STATE_RUNNING == vm->jfrWriterState) {
+			vm->jfrWriterState = J9JFR_WRITER_STATE_STOP;
+			omrthread_monitor_notify_all(vm->jfrWriterMutex);
+			while (J9JFR_WRITER_STATE_DEAD != vm->jfrWriterState) {
+				omrthread_monitor_wait(vm->jfrWriterMutex);
+			}
+		}
+		omrthread_monitor_exit(vm->jfrWriterMutex);
+		omrthread_monitor_destroy(vm->jfrWriterMutex);
+		vm->jfrWriterMutex = NULL;
+	}
+
 	internalAcquireVMAccess(currentThread);
 
 	vm->jfrState.isStarted = FALSE;
 	vm->jfrSamplerState = J9JFR_SAMPLER_STATE_UNINITIALIZED;
+	vm->jfrWriterState = J9JFR_WRITER_STATE_UNINITIALIZED;
 
 	VM_JFRWriter::teardownJFRWriter(vm);
 
@@ -933,10 +1360,28 @@ tearDownJFR(J9JavaVM *vm)
 	(*vmHooks)->J9HookUnregister(vmHooks, J9HOOK_VM_MONITOR_CONTENDED_ENTERED, jfrVMMonitorEntered, NULL);
 	(*vmHooks)->J9HookUnregister(vmHooks, J9HOOK_VM_UNPARKED, jfrVMThreadParked, NULL);
 	(*vmHooks)->J9HookUnregister(vmHooks, J9HOOK_SYSTEM_GC_CALLED, jfrSystemGC, NULL);
+	(*gcHooks)->J9HookUnregister(gcHooks, J9HOOK_MM_OBJECT_ALLOCATION_SAMPLING, jfrObjectAllocationSample, NULL);
+	(*gcOmrHooks)->J9HookUnregister(gcOmrHooks, J9HOOK_MM_OMR_GLOBAL_GC_START, jfrGCStart, NULL);
+	(*gcOmrHooks)->J9HookUnregister(gcOmrHooks, J9HOOK_MM_OMR_GLOBAL_GC_END, jfrGCEnd, NULL);
+	(*gcOmrHooks)->J9HookUnregister(gcOmrHooks, J9HOOK_MM_OMR_LOCAL_GC_START, jfrGCStart, NULL);
+	(*gcOmrHooks)->J9HookUnregister(gcOmrHooks, J9HOOK_MM_OMR_LOCAL_GC_END, jfrGCEnd, NULL);
+	if (NULL != jitHooks) {
+		(*jitHooks)->J9HookUnregister(jitHooks, J9HOOK_JIT_COMPILING_START, jfrCompilingStart, NULL);
+		(*jitHooks)->J9HookUnregister(jitHooks, J9HOOK_JIT_COMPILING_END, jfrCompilingEnd, NULL);
+	}
 
 	/* Free global data */
 	VM_JFRConstantPoolTypes::freeJFRConstantEvents(vm);
 
+	/* Any buffers still queued were not flushed before the recording stopped */
+	while (NULL != vm->jfrQueuedBuffers) {
+		J9JFRQueuedBuffer *queued = vm->jfrQueuedBuffers;
+		vm->jfrQueuedBuffers = queued->next;
+		j9mem_free_memory(queued->bufferStart);
+		j9mem_free_memory(queued);
+	}
+	vm->jfrQueuedBytes = 0;
+
 	j9mem_free_memory((void*)vm->jfrBuffer.bufferStart);
 	memset(&vm->jfrBuffer, 0, sizeof(vm->jfrBuffer));
 	if (NULL != vm->jfrBufferMutex) {
@@ -1009,6 +1454,140 @@ jfrExecutionSampleCallback(J9VMThread *currentThread, IDATA handlerKey, void *us
 	jfrExecutionSample(currentThread, currentThread);
 }
 
+/**
+ * Record a native method sample for a thread which is running outside of Java code.
+ * The event is written to the buffer of the current thread, since the sample thread
+ * may be using its own buffer once it is resumed.
+ *
+ * @param currentThread[in] the current J9VMThread, which must have VM access
+ * @param sampleThread[in] the J9VMThread to sample
+ */
+static void
+jfrNativeMethodSample(J9VMThread *currentThread, J9VMThread *sampleThread)
+{
+	haltThreadForInspection(currentThread, sampleThread);
+	J9JFRExecutionSample *jfrEvent = (J9JFRExecutionSample*)reserveThreadBufferWithStackTrace(currentThread, sampleThread, currentThread, J9JFR_EVENT_TYPE_NATIVE_METHOD_SAMPLE, sizeof(*jfrEvent));
+	if (NULL != jfrEvent) {
+		jfrEvent->threadState = J9JFR_THREAD_STATE_RUNNING;
+	}
+	resumeThreadForInspection(currentThread, sampleThread);
+}
+
+/**
+ * Advance the sampler's xorshift random number generator.
+ *
+ * @param seed[in/out] the generator state, which must not be 0
+ *
+ * @returns the next random number
+ */
+static U_64
+jfrSamplerNextRandom(U_64 *seed)
+{
+	U_64 x = *seed;
+	x ^= x << 13;
+	x ^= x >> 7;
+	x ^= x << 17;
+	*seed = x;
+	return x;
+}
+
+/**
+ * Add a thread to a fixed size random sample of the threads seen so far (reservoir sampling).
+ *
+ * @param sample[in/out] the sampled threads
+ * @param maxSampleSize[in] the number of entries in sample
+ * @param seen[in/out] the number of threads offered to the sample so far
+ * @param walkThread[in] the thread to offer
+ * @param seed[in/out] the random number generator state
+ */
+static void
+jfrSamplerOfferThread(J9VMThread **sample, UDATA maxSampleSize, UDATA *seen, J9VMThread *walkThread, U_64 *seed)
+{
+	UDATA slot = *seen;
+
+	*seen += 1;
+	if (slot >= maxSampleSize) {
+		slot = (UDATA)(jfrSamplerNextRandom(seed) % *seen);
+	}
+	if (slot < maxSampleSize) {
+		sample[slot] = walkThread;
+	}
+}
+
+/**
+ * Choose the threads to sample in this sampling period from a random subset of the threads
+ * which can run Java code. Threads running Java code are signalled to sample themselves at
+ * their next async check. Threads running native code are returned so that the sampler thread
+ * can sample them; their inspectorCount is incremented to keep them alive until
+ * jfrReleaseNativeSampleThreads() is called.
+ *
+ * @param currentThread[in] the current J9VMThread
+ * @param seed[in/out] the random number generator state
+ * @param nativeThreads[out] the native threads to sample, J9JFR_SAMPLER_MAX_NATIVE_THREADS entries
+ *
+ * @returns the number of entries in nativeThreads
+ */
+static UDATA
+jfrSelectSampleThreads(J9VMThread *currentThread, U_64 *seed, J9VMThread **nativeThreads)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+	J9VMThread *javaThreads[J9JFR_SAMPLER_MAX_JAVA_THREADS];
+	UDATA javaThreadsSeen = 0;
+	UDATA nativeThreadsSeen = 0;
+	UDATA const blockedFlags = J9_PUBLIC_FLAGS_THREAD_WAITING | J9_PUBLIC_FLAGS_THREAD_BLOCKED | J9_PUBLIC_FLAGS_THREAD_SLEEPING | J9_PUBLIC_FLAGS_THREAD_PARKED;
+
+	omrthread_monitor_enter(vm->vmThreadListMutex);
+	J9VMThread *walkThread = J9_LINKED_LIST_START_DO(vm->mainThread);
+	while (NULL != walkThread) {
+		if ((currentThread != walkThread) && VM_VMHelpers::threadCanRunJavaCode(walkThread)) {
+			UDATA publicFlags = walkThread->publicFlags;
+
+			if (0 != walkThread->inNative) {
+				jfrSamplerOfferThread(nativeThreads, J9JFR_SAMPLER_MAX_NATIVE_THREADS, &nativeThreadsSeen, walkThread, seed);
+			} else if (J9_ARE_ANY_BITS_SET(publicFlags, J9_PUBLIC_FLAGS_VM_ACCESS)) {
+				jfrSamplerOfferThread(javaThreads, J9JFR_SAMPLER_MAX_JAVA_THREADS, &javaThreadsSeen, walkThread, seed);
+			} else if (J9_ARE_NO_BITS_SET(publicFlags, blockedFlags) && (NULL != walkThread->threadObject)) {
+				/* Without atomic-free JNI, threads in native code do not hold VM access */
+				jfrSamplerOfferThread(nativeThreads, J9JFR_SAMPLER_MAX_NATIVE_THREADS, &nativeThreadsSeen, walkThread, seed);
+			}
+		}
+		walkThread = J9_LINKED_LIST_NEXT_DO(vm->mainThread, walkThread);
+	}
+
+	UDATA javaCount = OMR_MIN(javaThreadsSeen, J9JFR_SAMPLER_MAX_JAVA_THREADS);
+	for (UDATA i = 0; i < javaCount; i++) {
+		J9SignalAsyncEvent(vm, javaThreads[i], vm->jfrAsyncKey);
+	}
+	UDATA nativeCount = OMR_MIN(nativeThreadsSeen, J9JFR_SAMPLER_MAX_NATIVE_THREADS);
+	for (UDATA i = 0; i < nativeCount; i++) {
+		nativeThreads[i]->inspectorCount += 1;
+	}
+	omrthread_monitor_exit(vm->vmThreadListMutex);
+
+	return nativeCount;
+}
+
+/**
+ * Allow the native threads returned by jfrSelectSampleThreads() to die.
+ *
+ * @param currentThread[in] the current J9VMThread
+ * @param nativeThreads[in] the native threads which were sampled
+ * @param nativeCount[in] the number of entries in nativeThreads
+ */
+static void
+jfrReleaseNativeSampleThreads(J9VMThread *currentThread, J9VMThread **nativeThreads, UDATA nativeCount)
+{
+	J9JavaVM *vm = currentThread->javaVM;
+
+	omrthread_monitor_enter(vm->vmThreadListMutex);
+	for (UDATA i = 0; i < nativeCount; i++) {
+		if (0 == --(nativeThreads[i]->inspectorCount)) {
+			omrthread_monitor_notify_all(vm->vmThreadListMutex);
+		}
+	}
+	omrthread_monitor_exit(vm->vmThreadListMutex);
+}
+
 static void
 jfrCPULoad(J9VMThread *currentThread)
 {
@@ -1160,29 +1739,54 @@ jfrSamplingThreadProc(void *entryArg)
 {
 	J9JavaVM *vm = (J9JavaVM*)entryArg;
 	J9VMThread *currentThread = NULL;
+	PORT_ACCESS_FROM_JAVAVM(vm);
 
 	if (JNI_OK == attachSystemDaemonThread(vm, &currentThread, "JFR sampler")) {
+		U_64 seed = ((U_64)j9time_nano_time()) | 1;
+		I_64 nextStatisticsTicks = 0;
+		I_64 nextThreadCPULoadTicks = 0;
+
 		omrthread_monitor_enter(vm->jfrSamplerMutex);
 		vm->jfrSamplerState = J9JFR_SAMPLER_STATE_RUNNING;
 		omrthread_monitor_notify_all(vm->jfrSamplerMutex);
-		UDATA count = 0;
 		while (J9JFR_SAMPLER_STATE_STOP != vm->jfrSamplerState) {
-			J9SignalAsyncEvent(vm, NULL, vm->jfrAsyncKey);
-			if (0 == (count % 100)) { // 1 second
-				omrthread_monitor_exit(vm->jfrSamplerMutex);
+			J9VMThread *nativeThreads[J9JFR_SAMPLER_MAX_NATIVE_THREADS];
+			I_64 startTicks = j9time_nano_time();
+			I_64 waitMillis = J9JFR_SAMPLING_RATE;
+
+			omrthread_monitor_exit(vm->jfrSamplerMutex);
+			UDATA nativeCount = jfrSelectSampleThreads(currentThread, &seed, nativeThreads);
+			bool statisticsDue = (startTicks >= nextStatisticsTicks);
+			if ((0 != nativeCount) || statisticsDue) {
 				internalAcquireVMAccess(currentThread);
-				jfrCPULoad(currentThread);
-				jfrClassLoadingStatistics(currentThread);
-				jfrThreadStatistics(currentThread);
-				if (0 == (count % 1000)) { // 10 seconds
-					J9SignalAsyncEvent(vm, NULL, vm->jfrThreadCPULoadAsyncKey);
-					jfrThreadContextSwitchRate(currentThread);
+				for (UDATA i = 0; i < nativeCount; i++) {
+					jfrNativeMethodSample(currentThread, nativeThreads[i]);
+				}
+				if (statisticsDue) {
+					nextStatisticsTicks = startTicks + J9JFR_STATISTICS_PERIOD_NANOS;
+					jfrCPULoad(currentThread);
+					jfrClassLoadingStatistics(currentThread);
+					jfrThreadStatistics(currentThread);
+					if (startTicks >= nextThreadCPULoadTicks) {
+						nextThreadCPULoadTicks = startTicks + J9JFR_THREAD_CPU_LOAD_PERIOD_NANOS;
+						J9SignalAsyncEvent(vm, NULL, vm->jfrThreadCPULoadAsyncKey);
+						jfrThreadContextSwitchRate(currentThread);
+					}
 				}
 				internalReleaseVMAccess(currentThread);
-				omrthread_monitor_enter(vm->jfrSamplerMutex);
+				jfrReleaseNativeSampleThreads(currentThread, nativeThreads, nativeCount);
+			}
+
+			/* Stretch the sampling period if sampling took more than its share of it */
+			I_64 elapsedNanos = j9time_nano_time() - startTicks;
+			I_64 budgetMillis = (elapsedNanos * 100) / (J9JFR_SAMPLER_CPU_BUDGET_PERCENT * 1000 * 1000);
+			if (budgetMillis > waitMillis) {
+				waitMillis = budgetMillis;
+			}
+			omrthread_monitor_enter(vm->jfrSamplerMutex);
+			if (J9JFR_SAMPLER_STATE_STOP != vm->jfrSamplerState) {
+				omrthread_monitor_wait_timed(vm->jfrSamplerMutex, waitMillis, 0);
 			}
-			count += 1;
-			omrthread_monitor_wait_timed(vm->jfrSamplerMutex, J9JFR_SAMPLING_RATE, 0);
 		}
 		omrthread_monitor_exit(vm->jfrSamplerMutex);
 		DetachCurrentThread((JavaVM*)vm);
@@ -1195,6 +1799,41 @@ jfrSamplingThreadProc(void *entryArg)
 	return 0;
 }
 
+static int J9THREAD_PROC
+jfrWriterThreadProc(void *entryArg)
+{
+	J9JavaVM *vm = (J9JavaVM*)entryArg;
+	J9VMThread *currentThread = NULL;
+
+	if (JNI_OK == attachSystemDaemonThread(vm, &currentThread, "JFR writer")) {
+		omrthread_monitor_enter(vm->jfrWriterMutex);
+		vm->jfrWriterState = J9JFR_WRITER_STATE_RUNNING;
+		omrthread_monitor_notify_all(vm->jfrWriterMutex);
+		while (J9JFR_WRITER_STATE_STOP != vm->jfrWriterState) {
+			if (NULL == vm->jfrQueuedBuffers) {
+				omrthread_monitor_wait(vm->jfrWriterMutex);
+			} else {
+				omrthread_monitor_exit(vm->jfrWriterMutex);
+				/* Building a chunk requires VM access, which also keeps class unloading
+				 * and exiting threads from invalidating the data in the queued buffers.
+				 */
+				internalAcquireVMAccess(currentThread);
+				drainQueuedBuffers(currentThread);
+				internalReleaseVMAccess(currentThread);
+				omrthread_monitor_enter(vm->jfrWriterMutex);
+			}
+		}
+		omrthread_monitor_exit(vm->jfrWriterMutex);
+		DetachCurrentThread((JavaVM*)vm);
+	}
+
+	omrthread_monitor_enter(vm->jfrWriterMutex);
+	vm->jfrWriterState = J9JFR_WRITER_STATE_DEAD;
+	omrthread_monitor_notify_all(vm->jfrWriterMutex);
+	omrthread_exit(vm->jfrWriterMutex);
+	return 0;
+}
+
 jboolean
 setJFRRecordingFileName(J9JavaVM *vm, char *newFileName)
 {
@@ -46,6 +46,7 @@
 #include "util_api.h"
 #include "j9accessbarrier.h"
 
+#include "AtomicSupport.hpp"
 #include "VMHelpers.hpp"
 #include "VMAccess.hpp"
 #include "ObjectMonitor.hpp"
@@ -59,6 +60,7 @@ extern "C" {
 #define J9JNIID_METHOD  0
 #define J9JNIID_FIELD  1
 #define J9JNIID_STATIC  2
+#define J9JNIID_FLAGS_MASK  (J9JNIID_FIELD | J9JNIID_STATIC)
 
 static void * JNICALL getDirectBufferAddress (JNIEnv *env, jobject buf);
 static jmethodID JNICALL getMethodID (JNIEnv *env, jclass clazz, const char *name, const char *signature);
@@ -125,6 +127,8 @@ static jint JNICALL monitorEnter(JNIEnv* env, jobject obj);
 static jint JNICALL monitorExit(JNIEnv* env, jobject obj);
 static jboolean JNICALL isInstanceOf(JNIEnv *env, jobject obj, jclass clazz);
 static void* getMethodOrFieldID(JNIEnv *env, jclass classReference, const char *name, const char *signature, UDATA flags);
+static void* lookupJNIIDCache(J9VMThread *vmThread, J9Class *clazz, const char *name, UDATA nameLength, const char *signature, UDATA signatureLength, UDATA flags, UDATA hash);
+static void updateJNIIDCache(J9VMThread *vmThread, J9Class *clazz, void *id, UDATA flags, UDATA hash);
 static jobjectRefType JNICALL getObjectRefType(JNIEnv *env, jobject obj);
 
 static void * JNICALL getPrimitiveArrayCritical(JNIEnv *env, jarray array, jboolean *isCopy);
@@ -1802,6 +1806,9 @@ getMethodOrFieldID(JNIEnv *env, jclass classReference, const char *name, const c
 	UDATA element;
 	J9Class* declaringClass;
 	void* id;
+	UDATA nameLength;
+	UDATA signatureLength;
+	UDATA hash;
 
 	Trc_VM_getMethodOrFieldID_Entry(vmThread, name, signature, classReference, isField, isStatic);
 
@@ -1809,6 +1816,22 @@ getMethodOrFieldID(JNIEnv *env, jclass classReference, const char *name, const c
 
 	/* TODO: normalize name and signature? */
 
+	nameLength = strlen(name);
+	signatureLength = strlen(signature);
+	hash = flags;
+	for (UDATA i = 0; i < nameLength; i++) {
+		hash = (hash * 31) + (U_8)name[i];
+	}
+	for (UDATA i = 0; i < signatureLength; i++) {
+		hash = (hash * 31) + (U_8)signature[i];
+	}
+
+	clazz = J9VM_J9CLASS_FROM_JCLASS(vmThread, classReference);
+	id = lookupJNIIDCache(vmThread, clazz, name, nameLength, signature, signatureLength, flags, hash);
+	if (NULL != id) {
+		goto done;
+	}
+
 retry:
 	offset = 0;
 	element = 0;
@@ -1826,8 +1849,8 @@ retry:
 
 		nas.name = name;
 		nas.signature = signature;
-		nas.nameLength = (U_32)strlen(name);
-		nas.signatureLength = (U_32)strlen(signature);
+		nas.nameLength = (U_32)nameLength;
+		nas.signatureLength = (U_32)signatureLength;
 
 		lookupOptions |= (isStatic ? J9_LOOK_STATIC : J9_LOOK_VIRTUAL);
 
@@ -1843,8 +1866,8 @@ retry:
 		if (isStatic) {
 			void* fieldAddress = staticFieldAddress(vmThread,
 				clazz,
-				(U_8*)name, strlen(name),
-				(U_8*)signature, strlen(signature),
+				(U_8*)name, nameLength,
+				(U_8*)signature, signatureLength,
 				&declaringClass, &element,
 				0,
 				NULL);
@@ -1858,8 +1881,8 @@ retry:
 		} else {
 			offset = instanceFieldOffset(vmThread,
 				clazz,
-				(U_8*)name, strlen(name),
-				(U_8*)signature, strlen(signature),
+				(U_8*)name, nameLength,
+				(U_8*)signature, signatureLength,
 				&declaringClass, &element,
 				0);
 
@@ -1894,9 +1917,13 @@ retry:
 			} else {
 				id = getJNIMethodID(vmThread, (J9Method *) element);
 			}
+			if (NULL != id) {
+				updateJNIIDCache(vmThread, clazz, id, flags, hash);
+			}
 		}
 	}
 
+done:
 	TRIGGER_J9HOOK_VM_LOOKUP_JNI_ID(vmThread->javaVM->hookInterface,
 			vmThread, classReference, name, signature, (U_8)isStatic, (U_8)isField, id);
 
@@ -1913,6 +1940,101 @@ retry:
 }
 
 
+/**
+ * Look up the ID previously returned for the same name, signature and flags
+ * on the lookup class without taking any lock.
+ *
+ * The entries are tagged ID pointers which are validated against the name and
+ * signature of the field or method they currently refer to, so a hash collision
+ * or a racing update can only result in a miss.
+ *
+ * @param[in] vmThread the current J9VMThread
+ * @param[in] clazz the lookup class
+ * @param[in] name the field or method name
+ * @param[in] nameLength the length of name
+ * @param[in] signature the field or method signature
+ * @param[in] signatureLength the length of signature
+ * @param[in] flags the J9JNIID_* flags of the lookup
+ * @param[in] hash the hash of the name, signature and flags
+ *
+ * @return the cached J9JNIFieldID or J9JNIMethodID, or NULL if there is none
+ */
+static void*
+lookupJNIIDCache(J9VMThread *vmThread, J9Class *clazz, const char *name, UDATA nameLength, const char *signature, UDATA signatureLength, UDATA flags, UDATA hash)
+{
+	void *id = NULL;
+	void **jniIDs = clazz->jniIDs;
+
+	/* The class must be initialized, as the lookup would otherwise have to initialize or wait for it */
+	if ((NULL != jniIDs) && (J9ClassInitSucceeded == clazz->initializeStatus)) {
+		UDATA *cache = J9VM_JNIID_LOOKUP_CACHE(jniIDs, clazz->romClass);
+		if (cache[0] == vmThread->javaVM->hotSwapCount) {
+			VM_AtomicSupport::readBarrier();
+			UDATA entry = cache[1 + (hash % J9VM_JNIID_LOOKUP_CACHE_ENTRIES)];
+			if ((0 != entry) && ((entry & J9JNIID_FLAGS_MASK) == flags)) {
+				J9UTF8 *idName = NULL;
+				J9UTF8 *idSignature = NULL;
+				void *candidate = (void *)(entry & ~(UDATA)J9JNIID_FLAGS_MASK);
+				if (J9_ARE_ANY_BITS_SET(flags, J9JNIID_FIELD)) {
+					J9ROMFieldShape *field = ((J9JNIFieldID *)candidate)->field;
+					idName = J9ROMFIELDSHAPE_NAME(field);
+					idSignature = J9ROMFIELDSHAPE_SIGNATURE(field);
+				} else {
+					J9ROMMethod *romMethod = J9_ROM_METHOD_FROM_RAM_METHOD(((J9JNIMethodID *)candidate)->method);
+					idName = J9ROMMETHOD_NAME(romMethod);
+					idSignature = J9ROMMETHOD_SIGNATURE(romMethod);
+				}
+				if (J9UTF8_DATA_EQUALS(J9UTF8_DATA(idName), J9UTF8_LENGTH(idName), name, nameLength)
+					&& J9UTF8_DATA_EQUALS(J9UTF8_DATA(idSignature), J9UTF8_LENGTH(idSignature), signature, signatureLength)
+				) {
+					id = candidate;
+				}
+			}
+		}
+	}
+
+	return id;
+}
+
+/**
+ * Record the ID returned for a lookup on the lookup class. The cache is
+ * discarded the first time it is updated after a class redefinition.
+ *
+ * @param[in] vmThread the current J9VMThread
+ * @param[in] clazz the lookup class
+ * @param[in] id the J9JNIFieldID or J9JNIMethodID
+ * @param[in] flags the J9JNIID_* flags of the lookup
+ * @param[in] hash the hash of the name, signature and flags
+ */
+static void
+updateJNIIDCache(J9VMThread *vmThread, J9Class *clazz, void *id, UDATA flags, UDATA hash)
+{
+	J9JavaVM *vm = vmThread->javaVM;
+	void **jniIDs = clazz->jniIDs;
+
+	if (NULL == jniIDs) {
+#ifdef J9VM_THR_PREEMPTIVE
+		omrthread_monitor_enter(vm->jniFrameMutex);
+#endif
+		jniIDs = ensureJNIIDTable(vmThread, clazz);
+#ifdef J9VM_THR_PREEMPTIVE
+		omrthread_monitor_exit(vm->jniFrameMutex);
+#endif
+	}
+
+	if (NULL != jniIDs) {
+		UDATA *cache = J9VM_JNIID_LOOKUP_CACHE(jniIDs, clazz->romClass);
+		UDATA hotSwapCount = vm->hotSwapCount;
+		if (cache[0] != hotSwapCount) {
+			/* Redefinition runs under exclusive VM access, so it cannot race with this update */
+			memset(cache + 1, 0, J9VM_JNIID_LOOKUP_CACHE_ENTRIES * sizeof(UDATA));
+			VM_AtomicSupport::writeBarrier();
+			cache[0] = hotSwapCount;
+		}
+		cache[1 + (hash % J9VM_JNIID_LOOKUP_CACHE_ENTRIES)] = (UDATA)id | flags;
+	}
+}
+
 /**
  * Ensures that an exception is pending in the current thread.
  * If no exception is currently pending, then a native OutOfMemoryError is thrown
@@ -2162,7 +2284,7 @@ ensureJNIIDTable(J9VMThread *currentThread, J9Class* clazz)
 	jniIDs = clazz->jniIDs;
 	if (jniIDs == NULL) {
 		J9ROMClass * romclass = clazz->romClass;
-		UDATA size = J9VM_NUM_OF_ENTRIES_IN_CLASS_JNIID_TABLE(romclass) * sizeof(void *);
+		UDATA size = (J9VM_NUM_OF_ENTRIES_IN_CLASS_JNIID_TABLE(romclass) + J9VM_JNIID_LOOKUP_CACHE_SLOTS) * sizeof(void *);
 
 		jniIDs = (void**)j9mem_allocate_memory(size, J9MEM_CATEGORY_JNI);
 		if (jniIDs != NULL) {
@@ -1058,9 +1058,7 @@ outOfBounds:
 		UDATA byteCount = ulen * sizeof(U_16);
 		JAVA_OFFLOAD_SWITCH_ON_WITH_REASON_IF_LIMIT_EXCEEDED(currentThread, J9_JNI_OFFLOAD_SWITCH_GET_STRING_REGION, byteCount);
 		if (IS_STRING_COMPRESSED(currentThread, stringObject)) {
-			for (jsize i = 0; i < len; ++i) {
-				buf[i] = (jchar)(U_8)J9JAVAARRAYOFBYTE_LOAD(currentThread, charArray, i + start);
-			}
+			VM_ArrayCopyHelpers::inflateFromByteArray(currentThread, charArray, ustart, ulen, (U_16 *)buf);
 		} else {
 			/* No guarantee of native memory alignment, so copy byte-wise */
 			VM_ArrayCopyHelpers::memcpyFromArray(currentThread, charArray, (UDATA)0, start * sizeof(U_16), byteCount, (void*)buf);
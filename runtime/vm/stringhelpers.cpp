@@ -29,6 +29,7 @@
 #include "ut_j9vm.h"
 
 #include "VMHelpers.hpp"
+#include "ArrayCopyHelpers.hpp"
 
 extern "C" {
 
@@ -216,6 +217,120 @@ compareStringToUTF8(J9VMThread *vmThread, j9object_t string, UDATA translateDots
 	return ((tmpUtfLength == 0) && (tmpStringLength == 0));
 }
 
+/* Masks used to test eight Latin-1 or four UTF-16 characters at once for the range [0x01, 0x7F],
+ * which are the only characters that encode to a single identical byte in modified UTF-8.
+ */
+#define J9_ASCII_WORD_LOW_BITS_I8 J9CONST_U64(0x0101010101010101)
+#define J9_ASCII_WORD_HIGH_BITS_I8 J9CONST_U64(0x8080808080808080)
+#define J9_ASCII_WORD_LOW_BITS_U16 J9CONST_U64(0x0001000100010001)
+#define J9_ASCII_WORD_HIGH_BITS_U16 J9CONST_U64(0x8000800080008000)
+#define J9_ASCII_WORD_NON_ASCII_BITS_U16 J9CONST_U64(0xFF80FF80FF80FF80)
+
+/**
+ * Encode a contiguous run of Latin-1 characters into modified UTF-8, copying eight
+ * characters at a time for as long as they are all in the range [0x01, 0x7F].
+ *
+ * @param[in] chars the Latin-1 characters
+ * @param[in] length the number of characters
+ * @param[out] utf8Data the output buffer
+ * @param[in] utf8DataLength the size of the output buffer
+ * @return the number of bytes written
+ */
+static UDATA
+encodeContiguousI8ToUTF8(const U_8 *chars, UDATA length, U_8 *utf8Data, UDATA utf8DataLength)
+{
+	U_8 *data = utf8Data;
+	UDATA i = 0;
+
+	while (i < length) {
+		UDATA remaining = utf8DataLength - (UDATA)(data - utf8Data);
+		while (((length - i) >= sizeof(U_64)) && (remaining >= sizeof(U_64))) {
+			U_64 word = 0;
+			memcpy(&word, chars + i, sizeof(U_64));
+			/* Stop at any byte with the high bit set or equal to zero. */
+			if (0 != ((word | ((word - J9_ASCII_WORD_LOW_BITS_I8) & ~word)) & J9_ASCII_WORD_HIGH_BITS_I8)) {
+				break;
+			}
+			memcpy(data, &word, sizeof(U_64));
+			data += sizeof(U_64);
+			i += sizeof(U_64);
+			remaining -= sizeof(U_64);
+		}
+		if (i == length) {
+			break;
+		}
+
+		I_8 unicode = (I_8)chars[i];
+		UDATA encodedLength = VM_VMHelpers::encodedUTF8LengthI8(unicode);
+
+		/* Stop writing to utf8Data if utf8DataLength will be exceeded. */
+		if (encodedLength > remaining) {
+			break;
+		}
+
+		VM_VMHelpers::encodeUTF8CharI8(unicode, data);
+		data += encodedLength;
+		i += 1;
+	}
+
+	return (UDATA)(data - utf8Data);
+}
+
+/**
+ * Encode a contiguous run of UTF-16 characters into modified UTF-8, narrowing four
+ * characters at a time for as long as they are all in the range [0x01, 0x7F].
+ *
+ * @param[in] chars the UTF-16 characters
+ * @param[in] length the number of characters
+ * @param[out] utf8Data the output buffer
+ * @param[in] utf8DataLength the size of the output buffer
+ * @return the number of bytes written
+ */
+static UDATA
+encodeContiguousU16ToUTF8(const U_16 *chars, UDATA length, U_8 *utf8Data, UDATA utf8DataLength)
+{
+	const UDATA charsPerWord = sizeof(U_64) / sizeof(U_16);
+	U_8 *data = utf8Data;
+	UDATA i = 0;
+
+	while (i < length) {
+		UDATA remaining = utf8DataLength - (UDATA)(data - utf8Data);
+		while (((length - i) >= charsPerWord) && (remaining >= charsPerWord)) {
+			U_64 word = 0;
+			memcpy(&word, chars + i, sizeof(U_64));
+			/* Stop at any character above 0x7F or equal to zero. */
+			if ((0 != (word & J9_ASCII_WORD_NON_ASCII_BITS_U16))
+				|| (0 != ((word - J9_ASCII_WORD_LOW_BITS_U16) & ~word & J9_ASCII_WORD_HIGH_BITS_U16))
+			) {
+				break;
+			}
+			for (UDATA j = 0; j < charsPerWord; j++) {
+				data[j] = (U_8)chars[i + j];
+			}
+			data += charsPerWord;
+			i += charsPerWord;
+			remaining -= charsPerWord;
+		}
+		if (i == length) {
+			break;
+		}
+
+		U_16 unicode = chars[i];
+		UDATA encodedLength = VM_VMHelpers::encodedUTF8Length(unicode);
+
+		/* Stop writing to utf8Data if utf8DataLength will be exceeded. */
+		if (encodedLength > remaining) {
+			break;
+		}
+
+		VM_VMHelpers::encodeUTF8Char(unicode, data);
+		data += encodedLength;
+		i += 1;
+	}
+
+	return (UDATA)(data - utf8Data);
+}
+
 UDATA
 copyStringToUTF8Helper(J9VMThread *vmThread, j9object_t string, UDATA stringFlags, UDATA stringOffset, UDATA stringLength, U_8 *utf8Data, UDATA utf8DataLength)
 {
@@ -225,8 +340,14 @@ copyStringToUTF8Helper(J9VMThread *vmThread, j9object_t string, UDATA stringFlag
 	U_8 *data = utf8Data;
 
 	if (IS_STRING_COMPRESSED(vmThread, string)) {
+		const U_8 *chars = NULL;
 		/* Manually version J9_STR_XLAT flag checking from the loop for performance as the compiler does not do it */
 		if ((stringFlags & J9_STR_XLAT) == 0) {
+			chars = (const U_8 *)VM_ArrayCopyHelpers::contiguousRangeAddress(vmThread, stringValue, 0, stringOffset, stringLength);
+		}
+		if (NULL != chars) {
+			data += encodeContiguousI8ToUTF8(chars, stringLength, data, utf8DataLength);
+		} else if ((stringFlags & J9_STR_XLAT) == 0) {
 			for (UDATA i = stringOffset; i < stringOffset + stringLength; i++) {
 				I_8 unicode = J9JAVAARRAYOFBYTE_LOAD(vmThread, stringValue, i);
 				UDATA encodedLength = VM_VMHelpers::encodedUTF8LengthI8(unicode);
@@ -257,8 +378,14 @@ copyStringToUTF8Helper(J9VMThread *vmThread, j9object_t string, UDATA stringFlag
 			}
 		}
 	} else {
+		const U_16 *chars = NULL;
 		/* Manually version J9_STR_XLAT flag checking from the loop for performance as the compiler does not do it */
 		if ((stringFlags & J9_STR_XLAT) == 0) {
+			chars = (const U_16 *)VM_ArrayCopyHelpers::contiguousRangeAddress(vmThread, stringValue, 1, stringOffset, stringLength);
+		}
+		if (NULL != chars) {
+			data += encodeContiguousU16ToUTF8(chars, stringLength, data, utf8DataLength);
+		} else if ((stringFlags & J9_STR_XLAT) == 0) {
 			for (UDATA i = stringOffset; i < stringOffset + stringLength; i++) {
 				U_16 unicode = J9JAVAARRAYOFCHAR_LOAD(vmThread, stringValue, i);
 				UDATA encodedLength = VM_VMHelpers::encodedUTF8Length(unicode);
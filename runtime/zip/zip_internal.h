@@ -138,6 +138,15 @@ typedef struct J9ZipCacheTraversal {
 	J9ZipFileEntry *fileRecordEntry;
 } J9ZipCacheTraversal;
 
+/**
+* @brief Build the hash index used to look up entries in a populated zip cache.
+* @param zipCache
+* @return BOOLEAN
+*/
+BOOLEAN
+zipCache_buildIndex(J9ZipCache * zipCache);
+
+
 /**
 * @brief
 * @param zipCache
@@ -45,13 +45,15 @@
  * The zip cache version number must be changed if the zip
  * cache format changes.
  */
-#define ZIP_CACHE_VERSION 1
+#define ZIP_CACHE_VERSION 2
 
 #define UDATA_TOP_BIT    (((UDATA)1)<<(sizeof(UDATA)*8-1))
 #define ISCLASS_BIT    UDATA_TOP_BIT
 #define NOT_FOUND	((UDATA) (~0))
 #define OFFSET_MASK	(~ISCLASS_BIT)
 #define	IMPLICIT_ENTRY	(~ISCLASS_BIT)
+/* Smallest number of slots in a hash index; indices are always a power of two in size */
+#define MIN_INDEX_SLOTS	8
 
 
 void zipCache_freeChunk (J9PortLibrary * portLib, J9ZipChunkHeader *chunk);
@@ -66,6 +68,15 @@ IDATA helper_memicmp (const void *src1, const void *src2, UDATA length);
 J9ZipDirEntry *zipCache_copyDirEntry(J9ZipCacheEntry *orgzce, J9ZipDirEntry *orgDirEntry, J9ZipCacheEntry *zce, J9ZipDirEntry *rootEntry);
 void zipCache_freeChunks(J9PortLibrary *portLib, J9ZipCacheEntry *zce);
 void zipCache_walkCache(J9PortLibrary * portLib, J9ZipCacheEntry *zce, J9ZipDirEntry *dirEntry);
+static UDATA zipCache_indexSlotCount(UDATA entryCount);
+static UDATA zipCache_indexHash(J9ZipCacheEntry *zce, J9ZipDirEntry *parent, const char *namePtr, UDATA nameSize, BOOLEAN isClass);
+static void zipCache_countEntries(J9ZipDirEntry *dirEntry, UDATA *fileCount, UDATA *dirCount);
+static void zipCache_indexInsert(J9ZipCacheIndexSlot *index, UDATA indexSize, UDATA hash, void *entry, J9ZipDirEntry *parent);
+static void zipCache_indexDirEntry(J9ZipCacheEntry *zce, J9ZipDirEntry *dirEntry);
+static void zipCache_fillIndex(J9ZipCacheEntry *zce, J9ZipCacheIndexSlot *slots, UDATA fileIndexSize, UDATA dirIndexSize);
+static void zipCache_discardIndex(J9PortLibrary *portLib, J9ZipCacheEntry *zce);
+static J9ZipFileEntry *zipCache_lookupFile(J9ZipCacheEntry *zce, J9ZipDirEntry *dirEntry, const char *namePtr, UDATA nameSize, BOOLEAN isClass);
+static J9ZipDirEntry *zipCache_lookupDir(J9ZipCacheEntry *zce, J9ZipDirEntry *dirEntry, const char *namePtr, UDATA nameSize, BOOLEAN isClass);
 
 #define ZIP_SRP_SET(field, value) WSRP_PTR_SET(&field, value)
 #define ZIP_SRP_GET(field, type) WSRP_PTR_GET(&field, type)
@@ -246,6 +257,8 @@ UDATA zipCache_cacheSize(J9ZipCache * zipCache) {
 				separately rather than being reserved from the chunk */
 			sizeRequired += strlen((const char*)zipFileName) + 1;
 		}
+		/* the hash index is allocated separately, but is copied along with the entries */
+		sizeRequired += (zce->fileIndexSize + zce->dirIndexSize) * sizeof(J9ZipCacheIndexSlot);
 	}
 	return sizeRequired;
 }
@@ -358,6 +371,18 @@ BOOLEAN zipCache_copy(J9ZipCache * zipCache, void *cacheData, UDATA dataSize) {
 		return FALSE;
 	}
 
+	/* Rebuild the hash index over the copied entries. It is keyed by offsets within the copy,
+	 * so it remains valid wherever the shared memory is mapped. */
+	if ((0 != orgzce->fileIndexSize) || (0 != orgzce->dirIndexSize)) {
+		char *unused;
+		J9ZipCacheIndexSlot *slots = (J9ZipCacheIndexSlot *)zipCache_reserveEntry(zce, chunk,
+				(orgzce->fileIndexSize + orgzce->dirIndexSize) * sizeof(J9ZipCacheIndexSlot), 0, &unused);
+		if (NULL == slots) {
+			return FALSE;
+		}
+		zipCache_fillIndex(zce, slots, orgzce->fileIndexSize, orgzce->dirIndexSize);
+	}
+
 	/* Null the currentChunk so it can't be free'd */
 	ZIP_SRP_SET_TO_NULL(zce->currentChunk);
 
@@ -570,6 +595,9 @@ zipCache_addElement(J9ZipCache * zipCache, char *elementName, IDATA elementNameL
 		((elementOffset & OFFSET_MASK) == IMPLICIT_ENTRY))
 		return FALSE;
 
+	/* the hash index does not track entries added after it was built */
+	zipCache_discardIndex(portLib, zce);
+
 	dirEntry = &zce->root;
 
 	curName = elementName;
@@ -698,7 +726,7 @@ zipCache_findElement(J9ZipCache * zipCache, const char *elementName, IDATA eleme
 			/* The prefix we're looking at doesn't end with a '/', which means */
 			/* it is really the suffix of the elementName, and it's a filename. */
 
-			fileEntry = zipCache_searchFileList(dirEntry, curName, curSize, isClass);
+			fileEntry = zipCache_lookupFile(zce, dirEntry, curName, curSize, isClass);
 			if (fileEntry) {
 				return fileEntry->zipFileOffset & OFFSET_MASK;
 			}
@@ -710,7 +738,7 @@ zipCache_findElement(J9ZipCache * zipCache, const char *elementName, IDATA eleme
 		/* If we got here, we're looking at a prefix which ends with '/', or searchDirList is TRUE */
 		/* Treat that prefix as a subdirectory.  It will exist if elementName was added before. */
 
-		dirEntry = zipCache_searchDirList(dirEntry, curName, curSize, isClass);
+		dirEntry = zipCache_lookupDir(zce, dirEntry, curName, curSize, isClass);
 		if (!dirEntry)
 			return NOT_FOUND;
 		curName += prefixSize;
@@ -718,6 +746,51 @@ zipCache_findElement(J9ZipCache * zipCache, const char *elementName, IDATA eleme
 	}
 }
 
+/**
+ * Builds the hash index used by zipCache_findElement() once the cache has been
+ * populated. Each file and directory entry is indexed by its parent directory and
+ * its own name, so a lookup costs one probe per path component rather than a walk
+ * of every sibling list along the path.
+ *
+ * If the index cannot be allocated the cache remains usable, and lookups walk the
+ * directory lists as before.
+ *
+ * @param[in] zipCache the populated zip cache
+ *
+ * @return TRUE if the index was built or is not required, FALSE if it could not be allocated
+ */
+BOOLEAN
+zipCache_buildIndex(J9ZipCache * zipCache)
+{
+	J9ZipCacheInternal *zci = (J9ZipCacheInternal *)zipCache;
+	J9ZipCacheEntry *zce = zci->entry;
+	J9ZipCacheIndexSlot *slots;
+	UDATA fileCount = 0;
+	UDATA dirCount = 0;
+	UDATA fileIndexSize;
+	UDATA dirIndexSize;
+	PORT_ACCESS_FROM_PORT(zipCache->portLib);
+
+	if ((NULL == ZIP_SRP_GET(zce->currentChunk, J9ZipChunkHeader *))
+		|| (0 != zce->fileIndexSize)
+		|| (0 != zce->dirIndexSize)
+	) {
+		/* a copied cache already carries its index */
+		return TRUE;
+	}
+
+	zipCache_countEntries(&zce->root, &fileCount, &dirCount);
+	fileIndexSize = zipCache_indexSlotCount(fileCount);
+	dirIndexSize = zipCache_indexSlotCount(dirCount);
+	slots = (J9ZipCacheIndexSlot *)j9mem_allocate_memory((fileIndexSize + dirIndexSize) * sizeof(J9ZipCacheIndexSlot), J9MEM_CATEGORY_VM_JCL);
+	if (NULL == slots) {
+		return FALSE;
+	}
+	zipCache_fillIndex(zce, slots, fileIndexSize, dirIndexSize);
+	return TRUE;
+}
+
+
 /** 
  * Frees the zip cache chunks
  *
@@ -742,6 +815,8 @@ void zipCache_freeChunks(J9PortLibrary *portLib, J9ZipCacheEntry *zce)
 		return;
 	}
 
+	zipCache_discardIndex(portLib, zce);
+
 	chunk2 = (J9ZipChunkHeader *)(((U_8 *)zce) - sizeof(J9ZipChunkHeader));
 	if (((UDATA)(zipFileName - (U_8 *)chunk2)) >= ACTUAL_CHUNK_SIZE)   {
 		/* HACK!!  zce->info.zipFileName points outside the first chunk, therefore it was allocated
@@ -998,6 +1073,203 @@ J9ZipFileEntry *zipCache_searchFileList(J9ZipDirEntry * dirEntry, const char *na
 
 
 
+/* Returns the number of slots needed to index entryCount entries with a load factor below 3/4. */
+
+static UDATA
+zipCache_indexSlotCount(UDATA entryCount)
+{
+	UDATA slotCount = MIN_INDEX_SLOTS;
+
+	while ((slotCount - (slotCount >> 2)) <= entryCount) {
+		slotCount <<= 1;
+	}
+	return slotCount;
+}
+
+
+
+/* Hashes the key of an index slot: the parent directory and the name within it. */
+/* The parent is identified by its offset from the cache entry rather than its */
+/* address, so the index of a copied cache is valid in every process mapping it. */
+
+static UDATA
+zipCache_indexHash(J9ZipCacheEntry *zce, J9ZipDirEntry *parent, const char *namePtr, UDATA nameSize, BOOLEAN isClass)
+{
+	UDATA hash = (UDATA)((U_8 *)parent - (U_8 *)zce);
+	UDATA i;
+
+	for (i = 0; i < nameSize; i++) {
+		hash = (hash * 31) + (U_8)namePtr[i];
+	}
+	if (isClass) {
+		hash = ~hash;
+	}
+	return hash ^ (hash >> 16);
+}
+
+
+
+/* Counts the file and directory entries below dirEntry, not including dirEntry itself. */
+
+static void
+zipCache_countEntries(J9ZipDirEntry *dirEntry, UDATA *fileCount, UDATA *dirCount)
+{
+	J9ZipFileRecord *record = ZIP_SRP_GET(dirEntry->fileList, J9ZipFileRecord *);
+	J9ZipDirEntry *subDir = ZIP_SRP_GET(dirEntry->dirList, J9ZipDirEntry *);
+
+	while (NULL != record) {
+		*fileCount += record->entryCount;
+		record = ZIP_SRP_GET(record->next, J9ZipFileRecord *);
+	}
+	while (NULL != subDir) {
+		*dirCount += 1;
+		zipCache_countEntries(subDir, fileCount, dirCount);
+		subDir = ZIP_SRP_GET(subDir->next, J9ZipDirEntry *);
+	}
+}
+
+
+
+/* Stores entry in the first free slot from hash. The index always has a free slot. */
+
+static void
+zipCache_indexInsert(J9ZipCacheIndexSlot *index, UDATA indexSize, UDATA hash, void *entry, J9ZipDirEntry *parent)
+{
+	UDATA mask = indexSize - 1;
+	UDATA i = hash & mask;
+
+	while (0 != index[i].entry) {
+		i = (i + 1) & mask;
+	}
+	ZIP_SRP_SET(index[i].entry, entry);
+	ZIP_SRP_SET(index[i].parent, parent);
+}
+
+
+
+/* Adds the file and directory entries below dirEntry to the index. */
+
+static void
+zipCache_indexDirEntry(J9ZipCacheEntry *zce, J9ZipDirEntry *dirEntry)
+{
+	J9ZipCacheIndexSlot *fileIndex = ZIP_SRP_GET(zce->fileIndex, J9ZipCacheIndexSlot *);
+	J9ZipCacheIndexSlot *dirIndex = ZIP_SRP_GET(zce->dirIndex, J9ZipCacheIndexSlot *);
+	J9ZipFileRecord *record = ZIP_SRP_GET(dirEntry->fileList, J9ZipFileRecord *);
+	J9ZipDirEntry *subDir = ZIP_SRP_GET(dirEntry->dirList, J9ZipDirEntry *);
+	UDATA i;
+
+	while (NULL != record) {
+		J9ZipFileEntry *fileEntry = record->entry;
+		for (i = 0; i < record->entryCount; i++) {
+			UDATA hash = zipCache_indexHash(zce, dirEntry, J9ZIPFILEENTRY_NAME(fileEntry), fileEntry->nameLength,
+					(fileEntry->zipFileOffset & ISCLASS_BIT) != 0);
+			zipCache_indexInsert(fileIndex, zce->fileIndexSize, hash, fileEntry, dirEntry);
+			fileEntry = J9ZIPFILEENTRY_NEXT(fileEntry);
+		}
+		record = ZIP_SRP_GET(record->next, J9ZipFileRecord *);
+	}
+	while (NULL != subDir) {
+		const char *name = J9ZIPDIRENTRY_NAME(subDir);
+		UDATA hash = zipCache_indexHash(zce, dirEntry, name, strlen(name), (subDir->zipFileOffset & ISCLASS_BIT) != 0);
+		zipCache_indexInsert(dirIndex, zce->dirIndexSize, hash, subDir, dirEntry);
+		zipCache_indexDirEntry(zce, subDir);
+		subDir = ZIP_SRP_GET(subDir->next, J9ZipDirEntry *);
+	}
+}
+
+
+
+/* Initializes the index in slots, which holds fileIndexSize file slots followed by dirIndexSize directory slots. */
+
+static void
+zipCache_fillIndex(J9ZipCacheEntry *zce, J9ZipCacheIndexSlot *slots, UDATA fileIndexSize, UDATA dirIndexSize)
+{
+	memset(slots, 0, (fileIndexSize + dirIndexSize) * sizeof(J9ZipCacheIndexSlot));
+	ZIP_SRP_SET(zce->fileIndex, slots);
+	ZIP_SRP_SET(zce->dirIndex, slots + fileIndexSize);
+	zce->fileIndexSize = fileIndexSize;
+	zce->dirIndexSize = dirIndexSize;
+	zipCache_indexDirEntry(zce, &zce->root);
+}
+
+
+
+/* Frees the hash index of a cache which has not been copied. Lookups revert to walking the lists. */
+
+static void
+zipCache_discardIndex(J9PortLibrary *portLib, J9ZipCacheEntry *zce)
+{
+	J9ZipCacheIndexSlot *slots = ZIP_SRP_GET(zce->fileIndex, J9ZipCacheIndexSlot *);
+	PORT_ACCESS_FROM_PORT(portLib);
+
+	if ((NULL != slots) && (NULL != ZIP_SRP_GET(zce->currentChunk, J9ZipChunkHeader *))) {
+		zce->fileIndexSize = 0;
+		zce->dirIndexSize = 0;
+		ZIP_SRP_SET_TO_NULL(zce->fileIndex);
+		ZIP_SRP_SET_TO_NULL(zce->dirIndex);
+		j9mem_free_memory(slots);
+	}
+}
+
+
+
+/* Finds the file entry named namePtr[0..nameSize-1] in dirEntry, using the index if there is one. */
+
+static J9ZipFileEntry *
+zipCache_lookupFile(J9ZipCacheEntry *zce, J9ZipDirEntry *dirEntry, const char *namePtr, UDATA nameSize, BOOLEAN isClass)
+{
+	if (0 != zce->fileIndexSize) {
+		J9ZipCacheIndexSlot *index = ZIP_SRP_GET(zce->fileIndex, J9ZipCacheIndexSlot *);
+		UDATA mask = zce->fileIndexSize - 1;
+		UDATA i = zipCache_indexHash(zce, dirEntry, namePtr, nameSize, isClass) & mask;
+
+		while (0 != index[i].entry) {
+			J9ZipFileEntry *entry = ZIP_SRP_GET(index[i].entry, J9ZipFileEntry *);
+			if ((ZIP_SRP_GET(index[i].parent, J9ZipDirEntry *) == dirEntry)
+				&& (entry->nameLength == nameSize)
+				&& (((entry->zipFileOffset & ISCLASS_BIT) != 0) == (isClass != FALSE))
+				&& !memcmp(J9ZIPFILEENTRY_NAME(entry), namePtr, nameSize)
+			) {
+				return entry;
+			}
+			i = (i + 1) & mask;
+		}
+		return NULL;
+	}
+	return zipCache_searchFileList(dirEntry, namePtr, nameSize, isClass);
+}
+
+
+
+/* Finds the directory entry named namePtr[0..nameSize-1] in dirEntry, using the index if there is one. */
+
+static J9ZipDirEntry *
+zipCache_lookupDir(J9ZipCacheEntry *zce, J9ZipDirEntry *dirEntry, const char *namePtr, UDATA nameSize, BOOLEAN isClass)
+{
+	if (0 != zce->dirIndexSize) {
+		J9ZipCacheIndexSlot *index = ZIP_SRP_GET(zce->dirIndex, J9ZipCacheIndexSlot *);
+		UDATA mask = zce->dirIndexSize - 1;
+		UDATA i = zipCache_indexHash(zce, dirEntry, namePtr, nameSize, isClass) & mask;
+
+		while (0 != index[i].entry) {
+			J9ZipDirEntry *entry = ZIP_SRP_GET(index[i].entry, J9ZipDirEntry *);
+			const char *name = J9ZIPDIRENTRY_NAME(entry);
+			if ((ZIP_SRP_GET(index[i].parent, J9ZipDirEntry *) == dirEntry)
+				&& (((entry->zipFileOffset & ISCLASS_BIT) != 0) == (isClass != FALSE))
+				&& !strncmp(name, namePtr, nameSize)
+				&& ('\0' == name[nameSize])
+			) {
+				return entry;
+			}
+			i = (i + 1) & mask;
+		}
+		return NULL;
+	}
+	return zipCache_searchDirList(dirEntry, namePtr, nameSize, isClass);
+}
+
+
+
 /** 
  * Searches for a directory named elementName in zipCache and if found provides 
  * a handle to it that can be used to enumerate through all of the directory's files.
@@ -1429,6 +1429,10 @@ zip_readCacheData(J9PortLibrary * portLib, J9ZipFile *zipFile)
 		startCentralDir = (IDATA)((UDATA)endEntry.dirOffset);
 		zipCache_setStartCentralDir(zipFile->cache, startCentralDir);
 		result = zip_populateCache(portLib, zipFile, &endEntry, startCentralDir);
+		if (0 == result) {
+			/* Failing to build the index is not fatal, lookups then walk the directory lists */
+			zipCache_buildIndex(zipFile->cache);
+		}
 	}
 
 finished:
@@ -0,0 +1,71 @@
+/*
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ */
+package jit.test.loopReduction;
+
+public class copyingTROTUnsigned extends base {
+   static byte array1[] = new byte [base.MINIMUM_DEFAULT_ARRAY_LENGTH];
+   static char array2[] = new char [base.MINIMUM_DEFAULT_ARRAY_LENGTH];
+   static int startOffset0 = 0;
+   static int startOffset1 = 1;
+
+   static {
+      for (int k = 0; k < array1.length; k++)
+         array1[k] = (byte)('a' + k % 26);
+   }
+
+   public int test(Context c, int len){
+      int j = -1;
+      long start, end, elapsed;
+      // the ASCII prefix of a UTF-8 decoder ends at the first byte with the high bit set
+      int mark = len / 2;
+      if (len > 0)
+         array1[mark] = (byte)0xc3;
+      start = System.currentTimeMillis();
+      for (int iters = 0; iters < c.iterations()*50; iters++){
+         int i = startOffset1;
+         for (j = startOffset0; j < len; ){
+            int T = array1[j] & 0xff;
+            if (T >= 0x80)
+               break;
+            array2[i] = (char)T;
+            j++;
+            i++;
+         }
+      }
+      if (len > 0)
+         array1[mark] = (byte)('a' + mark % 26);
+      if (c.verify()) {
+         int expected = mark;
+         if (j != expected)
+            c.printerr(this.getClass().getName() + " got: " + j + " expected: " + expected);
+         for (int k = 0; k < expected; k++)
+            if (array2[k + startOffset1] != (char)array1[k]) {
+               c.printerr(this.getClass().getName() + " mismatch at " + k);
+               break;
+            }
+      }
+      end = System.currentTimeMillis();
+      elapsed = end - start;
+      c.println(this.getClass().getName() + ": len="+ len + ", test took " + elapsed + " millis");
+      return j;
+   }
+}
@@ -28,6 +28,7 @@ public class idiomTests
    public void testSimpleCharTRT(Context c) { new simpleCharTRT().runTest(c); }
    public void testTRTNestedArray(Context c) { new TRTNestedArray().runTest(c); }
    public void testCopyingTROT(Context c) { new copyingTROT().runTest(c); }
+   public void testCopyingTROTUnsigned(Context c) { new copyingTROTUnsigned().runTest(c); }
    public void testTROTArray(Context c) { new TROTArray().runTest(c); }
    public void testCopyingTRTO(Context c) { new copyingTRTO().runTest(c); }
    public void testTRTOArray(Context c) { new TRTOArray().runTest(c); }
@@ -65,6 +65,34 @@ public class TestArraysSupport {
         Assert.assertEquals(intrinsicResult, expectedResult, String.format("Unexpected integer hashcode result for array of length %d", arr.length));
     }
 
+    /* Arrays filled with the extreme values of each element type exercise sign and zero extension of the elements */
+
+    @Test(groups = "level.sanity", invocationCount = 2)
+    public void testVectorHashCodeExtremeValues() {
+        for (int length = 0; length < MAX_TEST_ARRAY_SIZE; length++) {
+            for (byte value : new byte[] {Byte.MIN_VALUE, -1, Byte.MAX_VALUE}) {
+                final byte[] arr = new byte[length];
+                Arrays.fill(arr, value);
+                Assert.assertEquals(Arrays.hashCode(arr), hashCode(1, arr, 0, length), String.format("Unexpected byte hashcode result for array of length %d filled with %d", length, value));
+            }
+            for (char value : new char[] {(char) 0x80, (char) 0xff, Character.MAX_VALUE}) {
+                final char[] arr = new char[length];
+                Arrays.fill(arr, value);
+                Assert.assertEquals(Arrays.hashCode(arr), hashCode(1, arr, 0, length), String.format("Unexpected char hashcode result for array of length %d filled with %d", length, (int) value));
+            }
+            for (short value : new short[] {Short.MIN_VALUE, -1, Short.MAX_VALUE}) {
+                final short[] arr = new short[length];
+                Arrays.fill(arr, value);
+                Assert.assertEquals(Arrays.hashCode(arr), hashCode(1, arr, 0, length), String.format("Unexpected short hashcode result for array of length %d filled with %d", length, value));
+            }
+            for (int value : new int[] {Integer.MIN_VALUE, -1, Integer.MAX_VALUE}) {
+                final int[] arr = new int[length];
+                Arrays.fill(arr, value);
+                Assert.assertEquals(Arrays.hashCode(arr), hashCode(1, arr, 0, length), String.format("Unexpected integer hashcode result for array of length %d filled with %d", length, value));
+            }
+        }
+    }
+
     /* Generate MAX_TEST_ARRAY_SIZE number of random arrays for each element type */
 
     @DataProvider(name = "byteArrayProvider")
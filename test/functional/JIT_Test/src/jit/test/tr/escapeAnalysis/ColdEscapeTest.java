@@ -0,0 +1,125 @@
+/*
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ */
+package jit.test.tr.escapeAnalysis;
+
+import java.util.Optional;
+
+import org.testng.AssertJUnit;
+import org.testng.annotations.Test;
+
+/**
+ * Objects that escape only on a rarely taken branch. Once the methods are
+ * recompiled with profiled block frequencies, escape analysis keeps the
+ * objects local on the hot path and heapifies them only on the rare branch.
+ * The escaped objects must still carry every field value stored before the
+ * escape point.
+ */
+@Test(groups = { "level.sanity","component.jit" })
+public class ColdEscapeTest {
+	static final int ITERATIONS = 200000;
+	static final int RARE_INTERVAL = 1000;
+
+	static Builder lastLoggedBuilder;
+	static Optional<String> lastLoggedOptional;
+
+	static final class Builder {
+		int a;
+		long b;
+		String name;
+
+		Builder a(int a) {
+			this.a = a;
+			return this;
+		}
+
+		Builder b(long b) {
+			this.b = b;
+			return this;
+		}
+
+		Builder name(String name) {
+			this.name = name;
+			return this;
+		}
+
+		long build() {
+			return a + b + name.length();
+		}
+	}
+
+	static void log(Builder builder) {
+		lastLoggedBuilder = builder;
+	}
+
+	static void log(Optional<String> optional) {
+		lastLoggedOptional = optional;
+	}
+
+	static long buildAndMaybeLog(int i) {
+		Builder builder = new Builder().a(i).b(2L * i).name("builder");
+		if (i % RARE_INTERVAL == 0) {
+			log(builder);
+		}
+		return builder.build();
+	}
+
+	static int optionalAndMaybeLog(int i, String value) {
+		Optional<String> optional = Optional.ofNullable(value);
+		if (i % RARE_INTERVAL == 0) {
+			log(optional);
+		}
+		return optional.map(String::length).orElse(-1);
+	}
+
+	@Test
+	public void testBuilderEscapesOnRareBranch() {
+		for (int i = 1; i < ITERATIONS; i++) {
+			lastLoggedBuilder = null;
+			long result = buildAndMaybeLog(i);
+			AssertJUnit.assertEquals("Wrong result at iteration " + i, 3L * i + 7, result);
+			if (i % RARE_INTERVAL == 0) {
+				AssertJUnit.assertNotNull("Builder not logged at iteration " + i, lastLoggedBuilder);
+				AssertJUnit.assertEquals("Wrong escaped a at iteration " + i, i, lastLoggedBuilder.a);
+				AssertJUnit.assertEquals("Wrong escaped b at iteration " + i, 2L * i, lastLoggedBuilder.b);
+				AssertJUnit.assertEquals("Wrong escaped name at iteration " + i, "builder", lastLoggedBuilder.name);
+			} else {
+				AssertJUnit.assertNull("Builder logged at iteration " + i, lastLoggedBuilder);
+			}
+		}
+	}
+
+	@Test
+	public void testOptionalEscapesOnRareBranch() {
+		for (int i = 1; i < ITERATIONS; i++) {
+			lastLoggedOptional = null;
+			String value = ((i & 1) == 0) ? "even" : null;
+			int result = optionalAndMaybeLog(i, value);
+			AssertJUnit.assertEquals("Wrong result at iteration " + i, (value == null) ? -1 : 4, result);
+			if (i % RARE_INTERVAL == 0) {
+				AssertJUnit.assertNotNull("Optional not logged at iteration " + i, lastLoggedOptional);
+				AssertJUnit.assertEquals("Wrong escaped Optional at iteration " + i, Optional.ofNullable(value), lastLoggedOptional);
+			} else {
+				AssertJUnit.assertNull("Optional logged at iteration " + i, lastLoggedOptional);
+			}
+		}
+	}
+}
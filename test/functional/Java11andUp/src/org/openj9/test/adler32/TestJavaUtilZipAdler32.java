@@ -0,0 +1,114 @@
+/*
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ */
+
+package org.openj9.test.adler32;
+import org.testng.AssertJUnit;
+import org.testng.annotations.Test;
+
+import java.util.Arrays;
+import java.util.Random;
+import java.util.zip.Adler32;
+import java.nio.ByteBuffer;
+
+public class TestJavaUtilZipAdler32 {
+    private static final int MAX_LENGTH = 300;
+    private static final int MAX_OFFSET = 16;
+    /* Longer than the 5552 bytes after which the kernel must reduce its sums */
+    private static final int LONG_LENGTH = 20000;
+    private static final byte[] data = new byte[MAX_LENGTH + MAX_OFFSET];
+
+    static {
+        new Random(0x5eed).nextBytes(data);
+    }
+
+    /* Reference implementation reducing the sums after every byte */
+    private static long referenceAdler32(long adler, byte[] b, int off, int len) {
+        int s1 = (int)(adler & 0xffff);
+        int s2 = (int)(adler >>> 16);
+        for (int i = off; i < off + len; i++) {
+            s1 = (s1 + (b[i] & 0xff)) % 65521;
+            s2 = (s2 + s1) % 65521;
+        }
+        return ((long)s2 << 16) | s1;
+    }
+
+    @Test(groups = {"level.sanity"}, invocationCount=2)
+    public static void testAdler32UpdateByte() {
+        Adler32 checksum = new Adler32();
+        for (int i = 0; i < MAX_LENGTH; i++) {
+            checksum.update(data[i]);
+            AssertJUnit.assertEquals(String.format("Incorrect checksum after %d single byte updates", i + 1), referenceAdler32(1, data, 0, i + 1), checksum.getValue());
+        }
+    }
+
+    @Test(groups = {"level.sanity"}, invocationCount=2)
+    public static void testAdler32UpdateByteArrayOffset() {
+        Adler32 checksum = new Adler32();
+        for (int off = 0; off < MAX_OFFSET; off++) {
+            for (int len = 0; len <= MAX_LENGTH; len++) {
+                checksum.update(data, off, len);
+                AssertJUnit.assertEquals(String.format("Incorrect checksum for length %d byte array with offset %d", len, off), referenceAdler32(1, data, off, len), checksum.getValue());
+                checksum.reset();
+            }
+        }
+    }
+
+    @Test(groups = {"level.sanity"}, invocationCount=2)
+    public static void testAdler32UpdateDirectByteBufferOffset() {
+        Adler32 checksum = new Adler32();
+        ByteBuffer bb = ByteBuffer.allocateDirect(data.length);
+        bb.put(data);
+        for (int off = 0; off < MAX_OFFSET; off++) {
+            for (int len = 0; len <= MAX_LENGTH; len++) {
+                bb.limit(off + len);
+                bb.position(off);
+                checksum.update(bb);
+                AssertJUnit.assertEquals(String.format("Incorrect checksum for length %d direct ByteBuffer with offset %d", len, off), referenceAdler32(1, data, off, len), checksum.getValue());
+                checksum.reset();
+            }
+        }
+    }
+
+    @Test(groups = {"level.sanity"}, invocationCount=2)
+    public static void testAdler32UpdateLongMaximumBytes() {
+        /* All bytes 0xff give the largest sums between reductions */
+        byte[] ones = new byte[LONG_LENGTH];
+        Arrays.fill(ones, (byte)0xff);
+        Adler32 checksum = new Adler32();
+        for (int len = LONG_LENGTH - 64; len <= LONG_LENGTH; len++) {
+            checksum.update(ones, 0, len);
+            AssertJUnit.assertEquals(String.format("Incorrect checksum for length %d byte array of 0xff", len), referenceAdler32(1, ones, 0, len), checksum.getValue());
+            checksum.reset();
+        }
+    }
+
+    @Test(groups = {"level.sanity"}, invocationCount=2)
+    public static void testAdler32UpdateSplit() {
+        Adler32 checksum = new Adler32();
+        for (int split = 0; split <= MAX_LENGTH; split++) {
+            checksum.update(data, 0, split);
+            checksum.update(data, split, MAX_LENGTH - split);
+            AssertJUnit.assertEquals(String.format("Incorrect checksum for byte array updated in two parts split at %d", split), referenceAdler32(1, data, 0, MAX_LENGTH), checksum.getValue());
+            checksum.reset();
+        }
+    }
+}
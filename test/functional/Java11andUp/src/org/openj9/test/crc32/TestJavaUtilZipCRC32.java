@@ -0,0 +1,99 @@
+/*
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ */
+
+package org.openj9.test.crc32;
+import org.testng.AssertJUnit;
+import org.testng.annotations.Test;
+
+import java.util.Random;
+import java.util.zip.CRC32;
+import java.nio.ByteBuffer;
+
+public class TestJavaUtilZipCRC32 {
+    private static final int MAX_LENGTH = 300;
+    private static final int MAX_OFFSET = 16;
+    private static final byte[] data = new byte[MAX_LENGTH + MAX_OFFSET];
+
+    static {
+        new Random(0x5eed).nextBytes(data);
+    }
+
+    /* Bitwise reference implementation of the reflected CRC-32 polynomial */
+    private static long referenceCRC32(byte[] b, int off, int len) {
+        int crc = 0xffffffff;
+        for (int i = off; i < off + len; i++) {
+            crc ^= b[i] & 0xff;
+            for (int bit = 0; bit < 8; bit++) {
+                crc = (crc >>> 1) ^ (0xedb88320 & -(crc & 1));
+            }
+        }
+        return ~crc & 0xffffffffL;
+    }
+
+    @Test(groups = {"level.sanity"}, invocationCount=2)
+    public static void testCRC32UpdateByte() {
+        CRC32 checksum = new CRC32();
+        for (int i = 0; i < MAX_LENGTH; i++) {
+            checksum.update(data[i]);
+            AssertJUnit.assertEquals(String.format("Incorrect checksum after %d single byte updates", i + 1), referenceCRC32(data, 0, i + 1), checksum.getValue());
+        }
+    }
+
+    @Test(groups = {"level.sanity"}, invocationCount=2)
+    public static void testCRC32UpdateByteArrayOffset() {
+        CRC32 checksum = new CRC32();
+        for (int off = 0; off < MAX_OFFSET; off++) {
+            for (int len = 0; len <= MAX_LENGTH; len++) {
+                checksum.update(data, off, len);
+                AssertJUnit.assertEquals(String.format("Incorrect checksum for length %d byte array with offset %d", len, off), referenceCRC32(data, off, len), checksum.getValue());
+                checksum.reset();
+            }
+        }
+    }
+
+    @Test(groups = {"level.sanity"}, invocationCount=2)
+    public static void testCRC32UpdateDirectByteBufferOffset() {
+        CRC32 checksum = new CRC32();
+        ByteBuffer bb = ByteBuffer.allocateDirect(data.length);
+        bb.put(data);
+        for (int off = 0; off < MAX_OFFSET; off++) {
+            for (int len = 0; len <= MAX_LENGTH; len++) {
+                bb.limit(off + len);
+                bb.position(off);
+                checksum.update(bb);
+                AssertJUnit.assertEquals(String.format("Incorrect checksum for length %d direct ByteBuffer with offset %d", len, off), referenceCRC32(data, off, len), checksum.getValue());
+                checksum.reset();
+            }
+        }
+    }
+
+    @Test(groups = {"level.sanity"}, invocationCount=2)
+    public static void testCRC32UpdateSplit() {
+        CRC32 checksum = new CRC32();
+        for (int split = 0; split <= MAX_LENGTH; split++) {
+            checksum.update(data, 0, split);
+            checksum.update(data, split, MAX_LENGTH - split);
+            AssertJUnit.assertEquals(String.format("Incorrect checksum for byte array updated in two parts split at %d", split), referenceCRC32(data, 0, MAX_LENGTH), checksum.getValue());
+            checksum.reset();
+        }
+    }
+}
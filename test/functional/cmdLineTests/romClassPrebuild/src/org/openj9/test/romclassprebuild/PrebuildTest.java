@@ -0,0 +1,43 @@
+/*
+ * Copyright IBM Corp. and others 2026
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] https://openjdk.org/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0-only WITH Classpath-exception-2.0 OR GPL-2.0-only WITH OpenJDK-assembly-exception-1.0
+ */
+package org.openj9.test.romclassprebuild;
+
+/**
+ * Loads classes named in classlist.txt after giving the ROMClass prebuild
+ * threads time to build them, and checks that the classes work.
+ */
+public class PrebuildTest {
+	public static void main(String[] args) throws Exception {
+		long delayMillis = (args.length > 0) ? Long.parseLong(args[0]) : 2000;
+		Thread.sleep(delayMillis);
+
+		Prebuilt1 first = new Prebuilt1(3);
+		Prebuilt2 second = new Prebuilt2(4);
+		Class<?> third = Class.forName("org.openj9.test.romclassprebuild.Prebuilt3");
+		boolean passed = (first.sum(10) == 55)
+			&& (second.sum(10) == 110)
+			&& "Prebuilt3".equals(third.getSimpleName())
+			&& (third.getDeclaredMethods().length == 1);
+
+		System.out.println(passed ? "Test PASSED" : "Test FAILED");
+	}
+}